@@ -1,6 +1,7 @@
 #include "usearch/index.hpp"
 #include "usearch/index_plugins.hpp"
 #include <cassert>
+#include <new>
 #include <vector>
 
 #include <usearch/index_dense.hpp>
@@ -25,6 +26,7 @@ static_assert(sizeof(lantern_slot_t) == LANTERN_SLOT_SIZE);
 
 using add_result_t = typename index_dense_t::add_result_t;
 using search_result_t = typename index_dense_t::search_result_t;
+using search_batch_result_t = typename index_dense_t::search_batch_result_t;
 using labeling_result_t = typename index_dense_t::labeling_result_t;
 
 static_assert(std::is_same<usearch_key_t, index_dense_t::vector_key_t>::value, "Type mismatch between C and C++");
@@ -95,6 +97,41 @@ add_result_t add_(index_dense_t* index, usearch_key_t key, void const* vector, s
     }
 }
 
+add_result_t update_(index_dense_t* index, usearch_key_t key, void const* vector, scalar_kind_t kind,
+                     uint64_t slot = -1) {
+    switch (kind) {
+    case scalar_kind_t::f32_k: return index->update(key, (f32_t const*)vector, 0, true, slot);
+    case scalar_kind_t::f64_k: return index->update(key, (f64_t const*)vector, 0, true, slot);
+    case scalar_kind_t::f16_k: return index->update(key, (f16_t const*)vector, 0, true, slot);
+    case scalar_kind_t::i8_k: return index->update(key, (i8_t const*)vector, 0, true, slot);
+    case scalar_kind_t::b1x8_k: return index->update(key, (b1x8_t const*)vector, 0, true, slot);
+    default: return add_result_t{}.failed("Unknown scalar kind!");
+    }
+}
+
+/// Executor for the batch operations over the index. External storage is only accessed on the calling thread,
+/// as its retrievers call back into the host, so its batches never spawn other threads.
+executor_default_t index_executor_(size_t threads) noexcept {
+#ifdef LANTERN_INSIDE_POSTGRES
+    (void)threads;
+    return executor_default_t(1);
+#else
+    return executor_default_t(threads);
+#endif
+}
+
+add_result_t add_many_(index_dense_t* index, usearch_key_t const* keys, void const* vectors, size_t count,
+                       size_t stride, scalar_kind_t kind, executor_default_t& executor) {
+    switch (kind) {
+    case scalar_kind_t::f32_k: return index->add_many(keys, (f32_t const*)vectors, count, stride, executor);
+    case scalar_kind_t::f64_k: return index->add_many(keys, (f64_t const*)vectors, count, stride, executor);
+    case scalar_kind_t::f16_k: return index->add_many(keys, (f16_t const*)vectors, count, stride, executor);
+    case scalar_kind_t::i8_k: return index->add_many(keys, (i8_t const*)vectors, count, stride, executor);
+    case scalar_kind_t::b1x8_k: return index->add_many(keys, (b1x8_t const*)vectors, count, stride, executor);
+    default: return add_result_t{}.failed("Unknown scalar kind!");
+    }
+}
+
 std::size_t get_(index_dense_t* index, usearch_key_t key, size_t count, void* vector, scalar_kind_t kind) {
     switch (kind) {
     case scalar_kind_t::f32_k: return index->get(key, (f32_t*)vector, count);
@@ -108,23 +145,114 @@ std::size_t get_(index_dense_t* index, usearch_key_t key, size_t count, void* ve
 
 // todo:: add ef optional parameter
 search_result_t search_(index_dense_t* index, void const* vector, scalar_kind_t kind, size_t n,
-                        bool continue_search = false) {
+                        index_search_config_t config) {
+    std::size_t thread = index_dense_t::any_thread();
     switch (kind) {
 
+    case scalar_kind_t::f32_k: return index->search((f32_t const*)vector, n, config, thread);
+    case scalar_kind_t::f64_k: return index->search((f64_t const*)vector, n, config, thread);
+    case scalar_kind_t::f16_k: return index->search((f16_t const*)vector, n, config, thread);
+    case scalar_kind_t::i8_k: return index->search((i8_t const*)vector, n, config, thread);
+    case scalar_kind_t::b1x8_k: return index->search((b1x8_t const*)vector, n, config, thread);
+    default: return search_result_t().failed("Unknown scalar kind!");
+    }
+}
+
+using search_cursor_t = index_dense_t::search_cursor_t;
+
+search_cursor_t search_cursor_(index_dense_t* index, void const* vector, scalar_kind_t kind,
+                               index_search_config_t config) {
+    switch (kind) {
+    case scalar_kind_t::f32_k: return index->search_cursor((f32_t const*)vector, config);
+    case scalar_kind_t::f64_k: return index->search_cursor((f64_t const*)vector, config);
+    case scalar_kind_t::f16_k: return index->search_cursor((f16_t const*)vector, config);
+    case scalar_kind_t::i8_k: return index->search_cursor((i8_t const*)vector, config);
+    case scalar_kind_t::b1x8_k: return index->search_cursor((b1x8_t const*)vector, config);
+    default: return search_cursor_t();
+    }
+}
+
+// Cursor of `usearch_search_cursor_init`, along with the filter it was started with
+struct filtered_cursor_t {
+    search_cursor_t cursor;
+    usearch_filter_t filter;
+    void* filter_state;
+};
+
+// The search of the calling thread, that `usearch_search_ef` continues
+struct last_search_t {
+    index_dense_t const* index{};
+    search_cursor_t cursor;
+};
+thread_local last_search_t last_search;
+
+search_batch_result_t search_many_(index_dense_t* index, void const* vectors, scalar_kind_t kind, size_t count,
+                                   size_t n, usearch_key_t* keys, usearch_distance_t* distances, size_t* found,
+                                   index_search_config_t config) {
+    std::size_t thread = index_dense_t::any_thread();
+    switch (kind) {
     case scalar_kind_t::f32_k:
-        return index->search((f32_t const*)vector, n, index_dense_t::any_thread(), continue_search);
+        return index->search_many((f32_t const*)vectors, count, n, keys, distances, found, config, thread);
     case scalar_kind_t::f64_k:
-        return index->search((f64_t const*)vector, n, index_dense_t::any_thread(), continue_search);
+        return index->search_many((f64_t const*)vectors, count, n, keys, distances, found, config, thread);
     case scalar_kind_t::f16_k:
-        return index->search((f16_t const*)vector, n, index_dense_t::any_thread(), continue_search);
+        return index->search_many((f16_t const*)vectors, count, n, keys, distances, found, config, thread);
     case scalar_kind_t::i8_k:
-        return index->search((i8_t const*)vector, n, index_dense_t::any_thread(), continue_search);
+        return index->search_many((i8_t const*)vectors, count, n, keys, distances, found, config, thread);
     case scalar_kind_t::b1x8_k:
-        return index->search((b1x8_t const*)vector, n, index_dense_t::any_thread(), continue_search);
+        return index->search_many((b1x8_t const*)vectors, count, n, keys, distances, found, config, thread);
+    default: return search_batch_result_t().failed("Unknown scalar kind!");
+    }
+}
+
+template <typename predicate_at>
+search_result_t filtered_search_(index_dense_t* index, void const* vector, scalar_kind_t kind, size_t n,
+                                 predicate_at&& predicate, index_search_config_t config) {
+    std::size_t thread = index_dense_t::any_thread();
+    switch (kind) {
+    case scalar_kind_t::f32_k: return index->filtered_search((f32_t const*)vector, n, predicate, config, thread);
+    case scalar_kind_t::f64_k: return index->filtered_search((f64_t const*)vector, n, predicate, config, thread);
+    case scalar_kind_t::f16_k: return index->filtered_search((f16_t const*)vector, n, predicate, config, thread);
+    case scalar_kind_t::i8_k: return index->filtered_search((i8_t const*)vector, n, predicate, config, thread);
+    case scalar_kind_t::b1x8_k: return index->filtered_search((b1x8_t const*)vector, n, predicate, config, thread);
     default: return search_result_t().failed("Unknown scalar kind!");
     }
 }
 
+search_result_t search_range_(index_dense_t* index, void const* vector, scalar_kind_t kind, usearch_distance_t radius,
+                              size_t limit, index_search_config_t config) {
+    std::size_t thread = index_dense_t::any_thread();
+    switch (kind) {
+    case scalar_kind_t::f32_k: return index->search_range((f32_t const*)vector, radius, limit, config, thread);
+    case scalar_kind_t::f64_k: return index->search_range((f64_t const*)vector, radius, limit, config, thread);
+    case scalar_kind_t::f16_k: return index->search_range((f16_t const*)vector, radius, limit, config, thread);
+    case scalar_kind_t::i8_k: return index->search_range((i8_t const*)vector, radius, limit, config, thread);
+    case scalar_kind_t::b1x8_k: return index->search_range((b1x8_t const*)vector, radius, limit, config, thread);
+    default: return search_result_t().failed("Unknown scalar kind!");
+    }
+}
+
+// Matches of a range search, that didn't fit into the buffers of the caller
+struct range_cursor_t {
+    buffer_gt<usearch_key_t> keys;
+    buffer_gt<usearch_distance_t> distances;
+    std::size_t offset{};
+};
+
+index_search_config_t search_config_to_cpp(usearch_search_config_t const* config) {
+    // Zero expansion makes the index fall back to its own `expansion_search`
+    index_search_config_t result;
+    result.expansion = 0;
+    if (config) {
+        result.expansion = config->expansion;
+        result.exact = config->exact;
+        if (config->use_radius)
+            result.radius = config->radius;
+        result.selectivity = config->selectivity;
+    }
+    return result;
+}
+
 extern "C" {
 
 USEARCH_EXPORT usearch_index_t usearch_init(usearch_init_options_t* options, float* codebook, usearch_error_t* error) {
@@ -139,6 +267,11 @@ USEARCH_EXPORT usearch_index_t usearch_init(usearch_init_options_t* options, flo
         }
     }
     config.multi = options->multi;
+    config.cache_upper_levels = options->cache_upper_levels;
+#ifdef LANTERN_INSIDE_POSTGRES
+    // Postgres maps keys to tuples on its own and cleans up the removed ones with vacuum
+    config.enable_key_lookups = false;
+#endif
     metric_kind_t metric_kind = metric_kind_to_cpp(options->metric_kind);
     scalar_kind_t scalar_kind = scalar_kind_to_cpp(options->quantization);
 
@@ -155,6 +288,8 @@ USEARCH_EXPORT usearch_index_t usearch_init(usearch_init_options_t* options, flo
     opts.num_centroids = options->num_centroids;
     opts.num_subvectors = options->num_subvectors;
     opts.scalar_bits = bits_per_scalar(scalar_kind);
+    opts.arena = options->arena;
+    opts.colocated = options->colocated;
     index_dense_t index = index_dense_t::make(metric, opts, options->num_threads, config, codebook);
 
     if (options->retriever != nullptr || options->retriever_mut != nullptr) {
@@ -188,6 +323,16 @@ USEARCH_EXPORT void usearch_save(usearch_index_t index, char const* path, usearc
         *error = result.error.release();
 }
 
+USEARCH_EXPORT void usearch_save_reordered(usearch_index_t index, char const* path, usearch_error_t* error) {
+
+    assert(index && path && error);
+    index_dense_serialization_config_t config;
+    config.reorder = true;
+    serialization_result_t result = reinterpret_cast<index_dense_t*>(index)->save(path, config);
+    if (!result)
+        *error = result.error.release();
+}
+
 USEARCH_EXPORT void usearch_load(usearch_index_t index, char const* path, usearch_error_t* error) {
 
     assert(index && path && error);
@@ -231,7 +376,7 @@ USEARCH_EXPORT void usearch_header_set_entry_slot(char* headerp, uint64_t entry_
 }
 
 // ready!
-USEARCH_EXPORT usearch_index_metadata_t usearch_index_metadata(usearch_index_t index, usearch_error_t* error) {
+USEARCH_EXPORT usearch_index_metadata_t usearch_index_metadata(usearch_index_t index, usearch_error_t*) {
     usearch_index_metadata_t res{};
     precomputed_constants_t pre = reinterpret_cast<index_dense_t*>(index)->pre();
     lantern_storage_t::storage_metadata storage_meta = reinterpret_cast<index_dense_t*>(index)->storage_metadata();
@@ -251,6 +396,8 @@ USEARCH_EXPORT usearch_index_metadata_t usearch_index_metadata(usearch_index_t i
         .pq = storage_meta.pq,
         .num_centroids = storage_meta.pq_num_centroids,
         .num_subvectors = storage_meta.pq_num_subvectors,
+        .arena = storage_meta.arena,
+        .colocated = storage_meta.colocated,
     };
 
     res.inverse_log_connectivity = pre.inverse_log_connectivity;
@@ -364,23 +511,67 @@ USEARCH_EXPORT void usearch_add(
         *error = result.error.release();
 }
 
-void usearch_add_external(                                                                                    //
-    usearch_index_t index, usearch_label_t label, void const* vector, void* tape, usearch_scalar_kind_t kind, //
+USEARCH_EXPORT void usearch_add_many(                                                  //
+    usearch_index_t index, usearch_key_t const* keys, void const* vectors, size_t count, //
+    size_t vectors_stride, usearch_scalar_kind_t kind, size_t threads, usearch_error_t* error) {
+
+    assert(index && keys && vectors && error);
+    executor_default_t executor = index_executor_(threads);
+    add_result_t result = add_many_(reinterpret_cast<index_dense_t*>(index), keys, vectors, count, vectors_stride,
+                                    scalar_kind_to_cpp(kind), executor);
+    if (!result)
+        *error = result.error.release();
+}
+
+USEARCH_EXPORT void usearch_update(                                                        //
+    usearch_index_t index, usearch_key_t key, void const* vector, usearch_scalar_kind_t kind, //
+    usearch_error_t* error) {
+
+    assert(index && vector && error);
+    add_result_t result = update_(reinterpret_cast<index_dense_t*>(index), key, vector, scalar_kind_to_cpp(kind));
+    if (!result)
+        *error = result.error.release();
+}
+
+void usearch_add_external(                                                                               //
+    usearch_index_t index, usearch_label_t label, void const* vector, void*, usearch_scalar_kind_t kind, //
     int16_t level, uint64_t slot, usearch_error_t* error) {
     add_result_t result =
         add_(reinterpret_cast<index_dense_t*>(index), label, vector, scalar_kind_to_cpp(kind), level, slot);
     if (!result)
         *error = result.error.release();
 }
+
+void usearch_update_external(                                                                     //
+    usearch_index_t index, usearch_label_t label, void const* vector, usearch_scalar_kind_t kind, //
+    uint64_t slot, usearch_error_t* error) {
+    add_result_t result =
+        update_(reinterpret_cast<index_dense_t*>(index), label, vector, scalar_kind_to_cpp(kind), slot);
+    if (!result)
+        *error = result.error.release();
+}
 USEARCH_EXPORT void usearch_set_node_retriever(usearch_index_t index, void* retriever_ctx,
                                                usearch_node_retriever_t retriever,
-                                               usearch_node_retriever_t retriever_mut, usearch_error_t* error) {
+                                               usearch_node_retriever_t retriever_mut, usearch_error_t*) {
 
     index_dense_t* cast_index = reinterpret_cast<index_dense_t*>(index);
     assert(retriever_ctx && retriever && retriever_mut);
     cast_index->set_node_retriever(retriever_ctx, retriever, retriever_mut);
 }
 
+USEARCH_EXPORT void usearch_set_node_retriever_batch(usearch_index_t index,
+                                                     usearch_node_retriever_batch_t retriever_batch,
+                                                     usearch_error_t*) {
+
+    assert(index);
+    reinterpret_cast<index_dense_t*>(index)->set_node_retriever_batch(retriever_batch);
+}
+
+USEARCH_EXPORT bool usearch_contains(usearch_index_t index, usearch_key_t key, usearch_error_t*) {
+    assert(index);
+    return reinterpret_cast<index_dense_t*>(index)->count(key) != 0;
+}
+
 USEARCH_EXPORT size_t usearch_count(usearch_index_t index, usearch_key_t key, usearch_error_t*) {
     assert(index);
     return reinterpret_cast<index_dense_t*>(index)->count(key);
@@ -391,10 +582,24 @@ USEARCH_EXPORT size_t usearch_search_ef(
     size_t ef, bool continue_search, usearch_key_t* found_keys, usearch_distance_t* found_distances,
     usearch_error_t* error) {
 
-    // todo:: come back and use the custom EF
     assert(index && vector && error);
-    search_result_t result = search_(reinterpret_cast<index_dense_t*>(index), vector, scalar_kind_to_cpp(kind),
-                                     results_limit, continue_search);
+    index_dense_t* dense = reinterpret_cast<index_dense_t*>(index);
+    if (!continue_search) {
+        usearch_search_config_t config{};
+        config.expansion = ef;
+        last_search.index = dense;
+        last_search.cursor = search_cursor_(dense, vector, scalar_kind_to_cpp(kind), search_config_to_cpp(&config));
+        if (!last_search.cursor) {
+            last_search.index = nullptr;
+            *error = "Unknown scalar kind or out of memory!";
+            return 0;
+        }
+    } else if (last_search.index != dense) {
+        *error = "No search to continue on this thread!";
+        return 0;
+    }
+
+    search_result_t result = dense->search_next(last_search.cursor, results_limit);
     if (!result) {
         *error = result.error.release();
         return 0;
@@ -406,13 +611,180 @@ USEARCH_EXPORT size_t usearch_search_ef(
 USEARCH_EXPORT size_t usearch_search( //
     usearch_index_t index, void const* vector, usearch_scalar_kind_t kind, size_t results_limit,
     usearch_key_t* found_keys, usearch_distance_t* found_distances, usearch_error_t* error) {
-    return usearch_search_ef(index, vector, kind, results_limit, 0, false, found_keys, found_distances, error);
+    return usearch_search_with_config(index, vector, kind, results_limit, nullptr, found_keys, found_distances, error);
+}
+
+USEARCH_EXPORT size_t usearch_search_with_config(                                                //
+    usearch_index_t index, void const* vector, usearch_scalar_kind_t kind, size_t results_limit, //
+    usearch_search_config_t const* config, usearch_key_t* found_keys, usearch_distance_t* found_distances,
+    usearch_error_t* error) {
+
+    assert(index && vector && error);
+    search_result_t result = search_(reinterpret_cast<index_dense_t*>(index), vector, scalar_kind_to_cpp(kind),
+                                     results_limit, search_config_to_cpp(config));
+    if (!result) {
+        *error = result.error.release();
+        return 0;
+    }
+
+    return result.dump_to(found_keys, found_distances);
+}
+
+USEARCH_EXPORT void usearch_search_many(                                                         //
+    usearch_index_t index, void const* vectors, usearch_scalar_kind_t kind, size_t queries_count, //
+    size_t results_limit, usearch_search_config_t const* config,                                 //
+    usearch_key_t* found_keys, usearch_distance_t* found_distances, size_t* found_counts, usearch_error_t* error) {
+
+    assert(index && vectors && found_keys && found_distances && found_counts && error);
+    search_batch_result_t result =
+        search_many_(reinterpret_cast<index_dense_t*>(index), vectors, scalar_kind_to_cpp(kind), queries_count,
+                     results_limit, found_keys, found_distances, found_counts, search_config_to_cpp(config));
+    if (!result)
+        *error = result.error.release();
+}
+
+USEARCH_EXPORT size_t usearch_filtered_search(                                                   //
+    usearch_index_t index, void const* vector, usearch_scalar_kind_t kind, size_t results_limit, //
+    usearch_search_config_t const* config, usearch_filter_t filter, void* filter_state,          //
+    usearch_key_t* found_keys, usearch_distance_t* found_distances, usearch_error_t* error) {
+
+    assert(index && vector && filter && error);
+    auto predicate = [=](index_dense_t::member_cref_t const& member) noexcept {
+        return filter(member.key, filter_state) != 0;
+    };
+    search_result_t result = filtered_search_(reinterpret_cast<index_dense_t*>(index), vector, scalar_kind_to_cpp(kind),
+                                              results_limit, predicate, search_config_to_cpp(config));
+    if (!result) {
+        *error = result.error.release();
+        return 0;
+    }
+
+    return result.dump_to(found_keys, found_distances);
+}
+
+USEARCH_EXPORT size_t usearch_filtered_search_slots(                                               //
+    usearch_index_t index, void const* vector, usearch_scalar_kind_t kind, size_t results_limit,   //
+    usearch_search_config_t const* config, unsigned char const* allowed_slots, size_t slots_count, //
+    usearch_key_t* found_keys, usearch_distance_t* found_distances, usearch_error_t* error) {
+
+    assert(index && vector && (allowed_slots || !slots_count) && error);
+    auto predicate = [=](index_dense_t::member_cref_t const& member) noexcept {
+        std::size_t slot = member.slot;
+        return slot < slots_count && (allowed_slots[slot / CHAR_BIT] & (1u << (slot % CHAR_BIT)));
+    };
+    search_result_t result = filtered_search_(reinterpret_cast<index_dense_t*>(index), vector, scalar_kind_to_cpp(kind),
+                                              results_limit, predicate, search_config_to_cpp(config));
+    if (!result) {
+        *error = result.error.release();
+        return 0;
+    }
+
+    return result.dump_to(found_keys, found_distances);
+}
+
+USEARCH_EXPORT usearch_search_cursor_t usearch_search_cursor_init(         //
+    usearch_index_t index, void const* vector, usearch_scalar_kind_t kind, //
+    usearch_search_config_t const* config, usearch_filter_t filter, void* filter_state, usearch_error_t* error) {
+
+    assert(index && vector && error);
+    search_cursor_t cursor = search_cursor_(reinterpret_cast<index_dense_t*>(index), vector,
+                                            scalar_kind_to_cpp(kind), search_config_to_cpp(config));
+    if (!cursor) {
+        *error = "Unknown scalar kind or out of memory!";
+        return nullptr;
+    }
+    return new filtered_cursor_t{std::move(cursor), filter, filter_state};
+}
+
+USEARCH_EXPORT size_t usearch_search_cursor_next(                                //
+    usearch_index_t index, usearch_search_cursor_t cursor, size_t results_limit, //
+    usearch_key_t* found_keys, usearch_distance_t* found_distances, usearch_error_t* error) {
+
+    assert(index && cursor && error);
+    filtered_cursor_t* filtered = reinterpret_cast<filtered_cursor_t*>(cursor);
+    auto predicate = [=](index_dense_t::member_cref_t const& member) noexcept {
+        return !filtered->filter || filtered->filter(member.key, filtered->filter_state) != 0;
+    };
+    search_result_t result =
+        reinterpret_cast<index_dense_t*>(index)->search_next(filtered->cursor, results_limit, predicate);
+    if (!result) {
+        *error = result.error.release();
+        return 0;
+    }
+
+    return result.dump_to(found_keys, found_distances);
+}
+
+USEARCH_EXPORT void usearch_search_cursor_free(usearch_search_cursor_t cursor, usearch_error_t*) {
+    delete reinterpret_cast<filtered_cursor_t*>(cursor);
+}
+
+USEARCH_EXPORT size_t usearch_search_range(                                                                         //
+    usearch_index_t index, void const* vector, usearch_scalar_kind_t kind, usearch_distance_t radius, size_t limit, //
+    usearch_search_config_t const* config, usearch_key_t* found_keys, usearch_distance_t* found_distances,
+    size_t capacity, usearch_range_cursor_t* cursor, usearch_error_t* error) {
+
+    assert(index && vector && (capacity == 0 || (found_keys && found_distances)) && error);
+    if (cursor)
+        *cursor = nullptr;
+    search_result_t result =
+        search_range_(reinterpret_cast<index_dense_t*>(index), vector, scalar_kind_to_cpp(kind), radius,
+                      limit ? limit : std::numeric_limits<std::size_t>::max(), search_config_to_cpp(config));
+    if (!result) {
+        *error = result.error.release();
+        return 0;
+    }
+
+    std::size_t returned = (std::min)(result.count, capacity);
+    for (std::size_t i = 0; i != returned; ++i) {
+        index_dense_t::match_t match = result[i];
+        found_keys[i] = match.member.key;
+        found_distances[i] = match.distance;
+    }
+    if (!cursor || returned == result.count)
+        return returned;
+
+    // Copy the rest out of the thread context, that the next search will overwrite
+    std::size_t remaining = result.count - returned;
+    range_cursor_t* rest = new (std::nothrow) range_cursor_t{buffer_gt<usearch_key_t>(remaining),
+                                                             buffer_gt<usearch_distance_t>(remaining)};
+    if (!rest || !rest->keys || !rest->distances) {
+        delete rest;
+        *error = "Out of memory!";
+        return 0;
+    }
+    for (std::size_t i = 0; i != remaining; ++i) {
+        index_dense_t::match_t match = result[returned + i];
+        rest->keys[i] = match.member.key;
+        rest->distances[i] = match.distance;
+    }
+    *cursor = rest;
+    return returned;
+}
+
+USEARCH_EXPORT size_t usearch_range_cursor_next(                                                   //
+    usearch_range_cursor_t cursor, usearch_key_t* found_keys, usearch_distance_t* found_distances, //
+    size_t capacity, usearch_error_t*) {
+
+    assert(cursor && (capacity == 0 || (found_keys && found_distances)));
+    range_cursor_t* rest = reinterpret_cast<range_cursor_t*>(cursor);
+    std::size_t returned = (std::min)(rest->keys.size() - rest->offset, capacity);
+    if (!returned)
+        return 0;
+    std::memcpy(found_keys, rest->keys.data() + rest->offset, returned * sizeof(usearch_key_t));
+    std::memcpy(found_distances, rest->distances.data() + rest->offset, returned * sizeof(usearch_distance_t));
+    rest->offset += returned;
+    return returned;
+}
+
+USEARCH_EXPORT void usearch_range_cursor_free(usearch_range_cursor_t cursor, usearch_error_t*) {
+    delete reinterpret_cast<range_cursor_t*>(cursor);
 }
 
 // not used in lantern
 USEARCH_EXPORT size_t usearch_get(                          //
     usearch_index_t index, usearch_key_t key, size_t count, //
-    void* vectors, usearch_scalar_kind_t kind, usearch_error_t* error) {
+    void* vectors, usearch_scalar_kind_t kind, usearch_error_t*) {
 
     assert(index && vectors);
     return get_(reinterpret_cast<index_dense_t*>(index), key, count, vectors, scalar_kind_to_cpp(kind));
@@ -427,6 +799,26 @@ USEARCH_EXPORT size_t usearch_remove(usearch_index_t index, usearch_key_t key, u
     return result.completed;
 }
 
+USEARCH_EXPORT size_t usearch_remove_many( //
+    usearch_index_t index, usearch_key_t const* keys, size_t count, size_t threads, usearch_error_t* error) {
+
+    assert(index && (keys || !count) && error);
+    executor_default_t executor = index_executor_(threads);
+    labeling_result_t result = reinterpret_cast<index_dense_t*>(index)->remove(keys, keys + count, executor);
+    if (!result)
+        *error = result.error.release();
+    return result.completed;
+}
+
+USEARCH_EXPORT void usearch_reorder(usearch_index_t index, size_t threads, usearch_error_t* error) {
+
+    assert(index && error);
+    executor_default_t executor(threads);
+    index_dense_t::compaction_result_t result = reinterpret_cast<index_dense_t*>(index)->reorder(executor);
+    if (!result)
+        *error = result.error.release();
+}
+
 USEARCH_EXPORT size_t usearch_rename( //
     usearch_index_t index, usearch_key_t from, usearch_key_t to, usearch_error_t* error) {
 
@@ -479,4 +871,17 @@ USEARCH_EXPORT void usearch_exact_search(                             //
             query_distances[i] = static_cast<usearch_distance_t>(query_result[i].distance);
     }
 }
+
+USEARCH_EXPORT void usearch_train_codebook(                        //
+    float const* vectors, size_t count, size_t dimensions,        //
+    size_t num_centroids, size_t num_subvectors, size_t threads,  //
+    float* codebook, usearch_error_t* error) {
+
+    assert(vectors && codebook && error);
+    executor_default_t executor(threads);
+    pq_training_result_t result =
+        train_pq_codebook(vectors, count, dimensions, num_centroids, num_subvectors, codebook, {}, executor);
+    if (!result)
+        *error = result.error.release();
+}
 }
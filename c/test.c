@@ -1,6 +1,7 @@
 #include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/stat.h>
 
 #include "usearch.h"
@@ -28,7 +29,7 @@ float* create_vectors(size_t const count, size_t const dimensions) {
 }
 
 usearch_init_options_t create_options(size_t const dimensions) {
-    usearch_init_options_t opts;
+    usearch_init_options_t opts = {0};
     opts.connectivity = 3; // 32 in faiss
     opts.dimensions = dimensions;
     opts.expansion_add = 40;    // 40 in faiss
@@ -54,13 +55,13 @@ void test_init(size_t const collection_size, size_t const dimensions) {
     // Init index
     usearch_error_t error = NULL;
     usearch_init_options_t opts = create_options(dimensions);
-    usearch_index_t index = usearch_init(&opts, &error);
+    usearch_index_t index = usearch_init(&opts, NULL, &error);
     ASSERT(!error, error);
     usearch_free(index, &error);
     ASSERT(!error, error);
 
     // Init second time
-    index = usearch_init(&opts, &error);
+    index = usearch_init(&opts, NULL, &error);
     ASSERT(!error, error);
 
     ASSERT(usearch_size(index, &error) == 0, error);
@@ -92,7 +93,7 @@ void test_add_vector(size_t const collection_size, size_t const dimensions) {
 
     usearch_error_t error = NULL;
     usearch_init_options_t opts = create_options(dimensions);
-    usearch_index_t index = usearch_init(&opts, &error);
+    usearch_index_t index = usearch_init(&opts, NULL, &error);
     usearch_reserve(index, collection_size, &error);
 
     // Add vectors
@@ -128,7 +129,7 @@ void test_find_vector(size_t const collection_size, size_t const dimensions) {
 
     usearch_error_t error = NULL;
     usearch_init_options_t opts = create_options(dimensions);
-    usearch_index_t index = usearch_init(&opts, &error);
+    usearch_index_t index = usearch_init(&opts, NULL, &error);
     usearch_reserve(index, collection_size, &error);
 
     // Create result buffers
@@ -170,7 +171,7 @@ void test_get_vector(size_t const collection_size, size_t const dimensions) {
     usearch_error_t error = NULL;
     usearch_init_options_t opts = create_options(dimensions);
     opts.multi = true;
-    usearch_index_t index = usearch_init(&opts, &error);
+    usearch_index_t index = usearch_init(&opts, NULL, &error);
     usearch_reserve(index, collection_size, &error);
 
     // Create result buffers
@@ -206,7 +207,7 @@ void test_remove_vector(size_t const collection_size, size_t const dimensions) {
 
     usearch_error_t error = NULL;
     usearch_init_options_t opts = create_options(dimensions);
-    usearch_index_t index = usearch_init(&opts, &error);
+    usearch_index_t index = usearch_init(&opts, NULL, &error);
     usearch_reserve(index, collection_size, &error);
 
     // Add vectors
@@ -240,7 +241,7 @@ void test_save_load(size_t const collection_size, size_t const dimensions) {
 
     usearch_error_t error = NULL;
     usearch_init_options_t opts = create_options(dimensions);
-    usearch_index_t index = usearch_init(&opts, &error);
+    usearch_index_t index = usearch_init(&opts, NULL, &error);
     usearch_reserve(index, collection_size, &error);
 
     // Add vectors
@@ -258,7 +259,7 @@ void test_save_load(size_t const collection_size, size_t const dimensions) {
     ASSERT(!error, error);
 
     // Reinit
-    index = usearch_init(&opts, &error);
+    index = usearch_init(&opts, NULL, &error);
     ASSERT(!error, error);
     ASSERT(usearch_size(index, &error) == 0, error);
 
@@ -292,7 +293,7 @@ void test_view(size_t const collection_size, size_t const dimensions) {
 
     usearch_error_t error = NULL;
     usearch_init_options_t opts = create_options(dimensions);
-    usearch_index_t index = usearch_init(&opts, &error);
+    usearch_index_t index = usearch_init(&opts, NULL, &error);
     usearch_reserve(index, collection_size, &error);
 
     // Add vectors
@@ -310,7 +311,7 @@ void test_view(size_t const collection_size, size_t const dimensions) {
     ASSERT(!error, error);
 
     // Reinit
-    index = usearch_init(&opts, &error);
+    index = usearch_init(&opts, NULL, &error);
     ASSERT(!error, error);
 
     // View
@@ -322,6 +323,91 @@ void test_view(size_t const collection_size, size_t const dimensions) {
     printf("Test: View - PASSED\n");
 }
 
+int compare_distances(void const* a, void const* b) {
+    usearch_distance_t x = *(usearch_distance_t const*)a, y = *(usearch_distance_t const*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ *  This test validates the range search. It adds vectors to an l2sq index and searches for the ones within the median
+ *  distance from the first vector, receiving the first few matches in the output buffers, and the rest through the
+ *  cursor, in small batches. Every match must be within the radius, the distances must be ascending, and about as
+ *  many matches must be found, as there are vectors within the radius.
+ */
+void test_search_range(size_t const collection_size, size_t const dimensions) {
+    printf("Test: Range Search...\n");
+
+    usearch_error_t error = NULL;
+    usearch_init_options_t opts = create_options(dimensions);
+    opts.metric_kind = usearch_metric_l2sq_k;
+    opts.connectivity = 16; // Enough for the matches to stay connected, unlike the default 3
+    usearch_index_t index = usearch_init(&opts, NULL, &error);
+    usearch_reserve(index, collection_size, &error);
+
+    // Add vectors
+    float* data = create_vectors(collection_size, dimensions);
+    for (size_t i = 0; i < collection_size; ++i) {
+        usearch_key_t key = i;
+        usearch_add(index, key, data + i * dimensions, usearch_scalar_f32_k, &error);
+        ASSERT(!error, error);
+    }
+
+    // Pick the radius, so that about a half of the vectors are within it
+    usearch_distance_t* exact = (usearch_distance_t*)malloc(collection_size * sizeof(usearch_distance_t));
+    ASSERT(exact, "Failed to allocate memory");
+    for (size_t i = 0; i < collection_size; ++i) {
+        exact[i] = 0;
+        for (size_t j = 0; j < dimensions; ++j)
+            exact[i] += (data[j] - data[i * dimensions + j]) * (data[j] - data[i * dimensions + j]);
+    }
+    usearch_distance_t* sorted = (usearch_distance_t*)malloc(collection_size * sizeof(usearch_distance_t));
+    ASSERT(sorted, "Failed to allocate memory");
+    memcpy(sorted, exact, collection_size * sizeof(usearch_distance_t));
+    qsort(sorted, collection_size, sizeof(usearch_distance_t), compare_distances);
+    usearch_distance_t radius = sorted[collection_size / 2];
+    free(sorted);
+    size_t within = 0;
+    for (size_t i = 0; i < collection_size; ++i)
+        within += exact[i] <= radius;
+
+    // Receive the first matches directly, and the rest through the cursor
+    usearch_key_t* keys = (usearch_key_t*)malloc(collection_size * sizeof(usearch_key_t));
+    usearch_distance_t* distances = (usearch_distance_t*)malloc(collection_size * sizeof(usearch_distance_t));
+    ASSERT(keys && distances, "Failed to allocate memory");
+    usearch_range_cursor_t cursor = NULL;
+    size_t found = usearch_search_range(index, data, usearch_scalar_f32_k, radius, 0, NULL, keys, distances, 3,
+                                        &cursor, &error);
+    ASSERT(!error, error);
+    ASSERT(found <= 3 && (cursor != NULL) == (within > 3), "Unexpected range cursor");
+    if (cursor) {
+        ASSERT(usearch_range_cursor_next(cursor, NULL, NULL, 0, &error) == 0, "Nothing fits into empty buffers");
+        size_t batch;
+        while ((batch = usearch_range_cursor_next(cursor, keys + found, distances + found, 2, &error)) != 0)
+            found += batch;
+        ASSERT(!error, error);
+        usearch_range_cursor_free(cursor, &error);
+    }
+
+    ASSERT(found <= within && found * 10 >= within * 9, "Range search missed too many matches");
+    for (size_t i = 0; i < found; ++i) {
+        ASSERT(distances[i] <= radius && exact[keys[i]] <= radius, "Match outside of the radius");
+        ASSERT(i == 0 || distances[i - 1] <= distances[i], "Matches must be sorted by distance");
+    }
+
+    // The total number of matches may be limited
+    found = usearch_search_range(index, data, usearch_scalar_f32_k, radius, 2, NULL, keys, distances,
+                                 collection_size, NULL, &error);
+    ASSERT(!error, error);
+    ASSERT(found == (within < 2 ? within : 2), "Range search must respect the limit");
+
+    free(keys);
+    free(distances);
+    free(exact);
+    free(data);
+    usearch_free(index, &error);
+    printf("Test: Range Search - PASSED\n");
+}
+
 int main(int argc, char const* argv[]) {
 
     size_t collection_sizes[] = {11, 512};
@@ -335,6 +421,7 @@ int main(int argc, char const* argv[]) {
             test_remove_vector(collection_sizes[index], dimensions[jdx]);
             test_save_load(collection_sizes[index], dimensions[jdx]);
             test_view(collection_sizes[index], dimensions[jdx]);
+            test_search_range(collection_sizes[index], dimensions[jdx]);
         }
     }
 
@@ -18,6 +18,8 @@ extern "C" {
 #include <stdint.h>  // `uint64_t`
 
 USEARCH_EXPORT typedef void* usearch_index_t;
+USEARCH_EXPORT typedef void* usearch_range_cursor_t;
+USEARCH_EXPORT typedef void* usearch_search_cursor_t;
 USEARCH_EXPORT typedef uint64_t usearch_key_t;
 // in older versions this used to be called usearch_label_t and lantern inherited that
 // this just sets up an alias so the names are interchangable
@@ -27,6 +29,9 @@ USEARCH_EXPORT typedef float usearch_distance_t;
 // postgres #defines the two in the opposite order for uint64...
 // explicitly making these unsigned long long seems to be the only solution
 USEARCH_EXPORT typedef void* (*usearch_node_retriever_t)(void* ctx, unsigned long long index);
+// receives all neighbors of a candidate that are about to be scored, so their reads can be issued at once
+USEARCH_EXPORT typedef void (*usearch_node_retriever_batch_t)(void* ctx, unsigned long long const* indices,
+                                                              size_t count);
 
 // this is an upper bound. the actual index is smaller.
 #define USEARCH_EMPTY_INDEX_SIZE 512
@@ -44,6 +49,12 @@ USEARCH_EXPORT typedef char const* usearch_error_t;
  */
 USEARCH_EXPORT typedef usearch_distance_t (*usearch_metric_t)(void const*, void const*);
 
+/**
+ *  @brief  Callback for filtered search, that accepts the key of a candidate and the `state`
+ *          passed to `usearch_filtered_search`, returning non-zero if the candidate may be returned.
+ */
+USEARCH_EXPORT typedef int (*usearch_filter_t)(usearch_key_t key, void* state);
+
 /**
  *  @brief  Enumerator for the most common kinds of `usearch_metric_t`.
  *          Those are supported out of the box, with SIMD-optimizations for most common hardware.
@@ -114,6 +125,24 @@ USEARCH_EXPORT typedef struct usearch_init_options_t {
     bool pq;
     size_t num_centroids;
     size_t num_subvectors;
+    /**
+     *  @brief When set nodes and vectors are allocated from large arenas, instead of one by one.
+     *  Makes insertions cheaper and keeps nodes close in memory, but memory of the index
+     *  is only released once it is freed or cleared.
+     */
+    bool arena;
+    /**
+     *  @brief When set every vector is stored in the same allocation as its node, right after it,
+     *  like in the serialized index. Saves a cache miss per visited node, but vectors are always
+     *  copied into the index.
+     */
+    bool colocated;
+    /**
+     *  @brief When set the index keeps an in-memory copy of the nodes above the base level and their vectors,
+     *  built on load and maintained on insertion, so that every search descends to the base level without
+     *  fetching nodes from the storage or the retrievers. Costs about `1 / connectivity` of the index memory.
+     */
+    bool cache_upper_levels;
 } usearch_init_options_t;
 
 USEARCH_EXPORT typedef struct {
@@ -130,6 +159,32 @@ USEARCH_EXPORT typedef struct {
 
 USEARCH_EXPORT typedef usearch_index_metadata_t metadata_t;
 
+/**
+ *  @brief Per-query search options, overriding the index-wide ones without modifying the index.
+ *  A zero-initialized structure matches the default behavior of `usearch_search`.
+ */
+USEARCH_EXPORT typedef struct usearch_search_config_t {
+    /**
+     *  @brief The @b optional expansion factor, the "ef", used for this search.
+     *  If zero, the `expansion_search` of the index is used.
+     */
+    size_t expansion;
+    /**
+     *  @brief When set brute-forces exhaustive search over all entries in the index.
+     */
+    bool exact;
+    /**
+     *  @brief When set only matches within `radius` distance from the query are returned.
+     */
+    bool use_radius;
+    usearch_distance_t radius;
+    /**
+     *  @brief The @b optional fraction of entries, expected to pass the filter of `usearch_filtered_search`.
+     *  If zero, it is estimated by sampling the filter on a few entries.
+     */
+    double selectivity;
+} usearch_search_config_t;
+
 /**
  *  @brief Initializes a new instance of the index.
  *  @param options Pointer to the `usearch_init_options_t` structure containing initialization options.
@@ -158,6 +213,15 @@ USEARCH_EXPORT size_t usearch_serialized_length(usearch_index_t, usearch_error_t
  */
 USEARCH_EXPORT void usearch_save(usearch_index_t, char const* path, usearch_error_t* error);
 
+/**
+ *  @brief Saves the index to a file, with the nodes laid out in a locality-preserving order,
+ *  like the one of `usearch_reorder`, without changing the index in memory.
+ *  Searches in such a file, when it is viewed, touch fewer pages.
+ *  @param[in] path The file path where the index will be saved.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_save_reordered(usearch_index_t, char const* path, usearch_error_t* error);
+
 /**
  *  @brief Loads the index from a file.
  *  @param[in] path The file path from where the index will be loaded.
@@ -246,6 +310,38 @@ USEARCH_EXPORT void usearch_add(        //
     usearch_index_t, usearch_key_t key, //
     void const* vector, usearch_scalar_kind_t vector_kind, usearch_error_t* error);
 
+/**
+ *  @brief Replaces the vector associated with an existing key in place, keeping its slot in the index.
+ *  The entry is relinked across all of its levels, and the links pointing to it are revised, so that
+ *  changing a vector doesn't leave a removed entry behind, like a removal and an insertion would.
+ *  @param[in] key The key of the vector to be replaced.
+ *  @param[in] vector Pointer to the new vector data.
+ *  @param[in] vector_kind The scalar type used in the vector data.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_update(     //
+    usearch_index_t, usearch_key_t key, //
+    void const* vector, usearch_scalar_kind_t vector_kind, usearch_error_t* error);
+
+/**
+ *  @brief Adds a batch of vectors with keys to the index, reserving the capacity for all of them at once.
+ *  For product-quantized indexes the vectors of a batch are encoded together, which is much
+ *  faster than encoding them one by one with `usearch_add`. Must not be called concurrently
+ *  with other operations on the index.
+ *  @param[in] keys Array of `count` keys associated with the vectors.
+ *  @param[in] vectors Pointer to the first of `count` vectors.
+ *  @param[in] count The number of vectors to add.
+ *  @param[in] vectors_stride Number of bytes between consecutive vectors, or zero if they are contiguous.
+ *  @param[in] vector_kind The scalar type used in the vector data.
+ *  @param[in] threads Upper bound for the number of CPU threads to use, or zero to use all cores.
+ *  Indexes with external storage are always built on the calling thread, ignoring it.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_add_many(                                    //
+    usearch_index_t, usearch_key_t const* keys,                          //
+    void const* vectors, size_t count, size_t vectors_stride,            //
+    usearch_scalar_kind_t vector_kind, size_t threads, usearch_error_t* error);
+
 /**
  *  @brief Checks if the index contains a vector with a specific key.
  *  @param[in] key The key to be checked.
@@ -269,6 +365,8 @@ USEARCH_EXPORT size_t usearch_count(usearch_index_t, usearch_key_t, usearch_erro
  *  @param[in] query_kind The scalar type used in the query vector data.
  *  @param[in] count Upper bound on the number of neighbors to search, the "k" in "kANN".
  *  @param[in] ef The @ef optional exploration factor used for search (if passed 0, uses the default for this index).
+ *  @param[in] continue_search When set, returns the next `count` matches of the last search on the calling thread,
+ *  instead of starting a new one. Prefer `usearch_search_cursor_init`, which isn't bound to a thread.
  *  @param[out] keys Output buffer for up to `count` nearest neighbors keys.
  *  @param[out] distances Output buffer for up to `count` distances to nearest neighbors.
  *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
@@ -295,6 +393,161 @@ USEARCH_EXPORT size_t usearch_search(                           //
     void const* query_vector, usearch_scalar_kind_t query_kind, //
     size_t count, usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
 
+/**
+ *  @brief Performs k-Approximate Nearest Neighbors (kANN) Search for closest vectors to query,
+ *  with options specific to this call. Safe to use concurrently with different options.
+ *  @param[in] query_vector Pointer to the query vector data.
+ *  @param[in] query_kind The scalar type used in the query vector data.
+ *  @param[in] count Upper bound on the number of neighbors to search, the "k" in "kANN".
+ *  @param[in] config Options for this search, or `NULL` to use the defaults of the index.
+ *  @param[out] keys Output buffer for up to `count` nearest neighbors keys.
+ *  @param[out] distances Output buffer for up to `count` distances to nearest neighbors.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of found matches.
+ */
+USEARCH_EXPORT size_t usearch_search_with_config(                                     //
+    usearch_index_t,                                                                  //
+    void const* query_vector, usearch_scalar_kind_t query_kind,                       //
+    size_t count, usearch_search_config_t const* config,                              //
+    usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
+
+/**
+ *  @brief Performs k-Approximate Nearest Neighbors (kANN) Search for a batch of queries.
+ *  Queries sharing the same upper-level nodes of the graph fetch them once, which is faster than
+ *  calling `usearch_search_with_config` for every query, while returning the same results.
+ *  @param[in] query_vectors Pointer to `queries_count` contiguous query vectors.
+ *  @param[in] query_kind The scalar type used in the query vectors data.
+ *  @param[in] queries_count The number of queries.
+ *  @param[in] count Upper bound on the number of neighbors to search for every query.
+ *  @param[in] config Options for this search, or `NULL` to use the defaults of the index.
+ *  @param[out] keys Output buffer for `queries_count` rows of `count` nearest neighbors keys.
+ *  @param[out] distances Output buffer for `queries_count` rows of `count` distances to nearest neighbors.
+ *  @param[out] found Output buffer for the number of matches found for every query.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_search_many(                                              //
+    usearch_index_t,                                                                   //
+    void const* query_vectors, usearch_scalar_kind_t query_kind, size_t queries_count, //
+    size_t count, usearch_search_config_t const* config,                               //
+    usearch_key_t* keys, usearch_distance_t* distances, size_t* found, usearch_error_t* error);
+
+/**
+ *  @brief Performs k-Approximate Nearest Neighbors (kANN) Search for closest vectors to query,
+ *  returning only the ones passing the `filter`. With few entries passing, they are compared exhaustively.
+ *  Otherwise the graph is traversed through the passing entries and the neighbors of the rejected ones,
+ *  which stays accurate for selective filters, unlike filtering the results of `usearch_search`.
+ *  @param[in] query_vector Pointer to the query vector data.
+ *  @param[in] query_kind The scalar type used in the query vector data.
+ *  @param[in] count Upper bound on the number of neighbors to search, the "k" in "kANN".
+ *  @param[in] config Options for this search, or `NULL` to use the defaults of the index.
+ *  @param[in] filter Callback, returning non-zero for keys that may be returned.
+ *  @param[in] filter_state Opaque pointer passed to every `filter` call.
+ *  @param[out] keys Output buffer for up to `count` nearest neighbors keys.
+ *  @param[out] distances Output buffer for up to `count` distances to nearest neighbors.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of found matches.
+ */
+USEARCH_EXPORT size_t usearch_filtered_search(                                        //
+    usearch_index_t,                                                                  //
+    void const* query_vector, usearch_scalar_kind_t query_kind,                       //
+    size_t count, usearch_search_config_t const* config,                              //
+    usearch_filter_t filter, void* filter_state,                                      //
+    usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
+
+/**
+ *  @brief Same as `usearch_filtered_search`, but takes the passing entries as a bitmap of their slots,
+ *  where the i-th slot passes if bit `i % 8` of byte `i / 8` is set. Slots beyond `slots_count` never pass.
+ *  @param[in] allowed_slots Bitmap of at least `(slots_count + 7) / 8` bytes.
+ *  @param[in] slots_count Number of slots covered by the bitmap.
+ */
+USEARCH_EXPORT size_t usearch_filtered_search_slots(                                  //
+    usearch_index_t,                                                                  //
+    void const* query_vector, usearch_scalar_kind_t query_kind,                       //
+    size_t count, usearch_search_config_t const* config,                              //
+    unsigned char const* allowed_slots, size_t slots_count,                           //
+    usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
+
+/**
+ *  @brief Starts a resumable kANN search, that yields the matches batch by batch, closest first.
+ *  The cursor owns a copy of the query and all the search state, so it can be advanced from any thread,
+ *  concurrently with other searches, and is a cheap way to fetch more matches, than initially expected.
+ *  @param[in] query_vector Pointer to the query vector data, copied into the cursor.
+ *  @param[in] query_kind The scalar type used in the query vector data.
+ *  @param[in] config Options for this search, or `NULL` to use the defaults of the index.
+ *  @param[in] filter Optional callback, returning non-zero for keys that may be returned, or `NULL`.
+ *  @param[in] filter_state Opaque pointer passed to every `filter` call.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return A handle to the cursor, that must be freed with `usearch_search_cursor_free`, or `NULL` on failure.
+ */
+USEARCH_EXPORT usearch_search_cursor_t usearch_search_cursor_init(                      //
+    usearch_index_t,                                                                    //
+    void const* query_vector, usearch_scalar_kind_t query_kind,                         //
+    usearch_search_config_t const* config, usearch_filter_t filter, void* filter_state, //
+    usearch_error_t* error);
+
+/**
+ *  @brief Yields the next closest matches of a search, started with `usearch_search_cursor_init`.
+ *  Every batch is sorted, and the batches are ordered by distance up to the approximation error.
+ *  @param[in] cursor The cursor, that isn't advanced concurrently from other threads.
+ *  @param[in] count Upper bound on the number of matches to return in this batch.
+ *  @param[out] keys Output buffer for up to `count` nearest neighbors keys.
+ *  @param[out] distances Output buffer for up to `count` distances to nearest neighbors.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of found matches, zero once all of the reachable ones were returned.
+ */
+USEARCH_EXPORT size_t usearch_search_cursor_next(                                     //
+    usearch_index_t, usearch_search_cursor_t cursor, size_t count,                    //
+    usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
+
+/**
+ *  @brief Frees the cursor of `usearch_search_cursor_init`.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_search_cursor_free(usearch_search_cursor_t, usearch_error_t* error);
+
+/**
+ *  @brief Performs Range Search for all vectors within `radius` distance from the query,
+ *  however many there are, unlike the kANN search bounded by the expansion factor.
+ *  @param[in] query_vector Pointer to the query vector data.
+ *  @param[in] query_kind The scalar type used in the query vector data.
+ *  @param[in] radius Upper bound on the distance to the matches, inclusive.
+ *  @param[in] limit Upper bound on the total number of matches, or zero for no limit.
+ *  Only the closest `limit` matches are kept, if more are found.
+ *  @param[in] config Options for this search, or `NULL` to use the defaults of the index.
+ *  @param[out] keys Output buffer for up to `capacity` matches keys, sorted by distance.
+ *  @param[out] distances Output buffer for up to `capacity` distances to the matches.
+ *  @param[in] capacity The size of the output buffers.
+ *  @param[out] cursor Optional pointer, set to a cursor over the matches, that didn't fit into the
+ *  output buffers, or to `NULL` if all of them did. Must be freed with `usearch_range_cursor_free`.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of matches written to the output buffers.
+ */
+USEARCH_EXPORT size_t usearch_search_range(                                           //
+    usearch_index_t,                                                                  //
+    void const* query_vector, usearch_scalar_kind_t query_kind,                       //
+    usearch_distance_t radius, size_t limit, usearch_search_config_t const* config,   //
+    usearch_key_t* keys, usearch_distance_t* distances, size_t capacity,              //
+    usearch_range_cursor_t* cursor, usearch_error_t* error);
+
+/**
+ *  @brief Continues a Range Search, writing the next matches in the order of distance.
+ *  @param[out] keys Output buffer for up to `capacity` matches keys.
+ *  @param[out] distances Output buffer for up to `capacity` distances to the matches.
+ *  @param[in] capacity The size of the output buffers.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of matches written to the output buffers, zero once all of them were returned.
+ */
+USEARCH_EXPORT size_t usearch_range_cursor_next(                                      //
+    usearch_range_cursor_t,                                                           //
+    usearch_key_t* keys, usearch_distance_t* distances, size_t capacity,              //
+    usearch_error_t* error);
+
+/**
+ *  @brief Frees the matches, remaining in the cursor of `usearch_search_range`.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_range_cursor_free(usearch_range_cursor_t, usearch_error_t* error);
+
 /**
  *  @brief Retrieves the vector associated with the given key from the index.
  *  @param[in] key The key of the vector to retrieve.
@@ -316,6 +569,31 @@ USEARCH_EXPORT size_t usearch_get(                    //
  */
 USEARCH_EXPORT size_t usearch_remove(usearch_index_t, usearch_key_t key, usearch_error_t* error);
 
+/**
+ *  @brief Removes the vectors associated with a batch of keys from the index.
+ *  The removed vectors are skipped by searches at once. Once they make up a sixteenth of the index,
+ *  a pass over the whole graph unlinks them, reconnecting their neighbors, and their slots are
+ *  reused by the following insertions.
+ *  @param[in] keys Array of `count` keys of the vectors to be removed.
+ *  @param[in] count The number of keys.
+ *  @param[in] threads Upper bound for the number of CPU threads to use, or zero to use all cores.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ *  @return Number of vectors found under those names and dropped from the index.
+ */
+USEARCH_EXPORT size_t usearch_remove_many(                    //
+    usearch_index_t, usearch_key_t const* keys, size_t count, //
+    size_t threads, usearch_error_t* error);
+
+/**
+ *  @brief Renumbers the slots of the index in a locality-preserving order, a breadth-first traversal of
+ *  the graph from its entry point, so that the neighbors of every entry are stored nearby in memory
+ *  and in the saved files. Slots, previously passed to or returned from the index, are invalidated.
+ *  Must not run concurrently with any other operation. Not supported in external storage.
+ *  @param[in] threads The number of threads to relabel the graph with.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_reorder(usearch_index_t, size_t threads, usearch_error_t* error);
+
 /**
  *  @brief Renames the vector to map to a different key.
  *  @param[in] from The key of the vector to be renamed.
@@ -352,10 +630,27 @@ USEARCH_EXPORT int32_t usearch_newnode_level(usearch_index_t, usearch_error_t* e
  */
 USEARCH_EXPORT void usearch_set_node_retriever(usearch_index_t, void* retriever_ctx, usearch_node_retriever_t retriever,
                                                usearch_node_retriever_t retriever_mut, usearch_error_t* error);
+
+/**
+ * @brief Sets the @b optional batched node retriever for the externally managed index.
+ * Before scoring the unvisited neighbors of a candidate, the index passes all of their slots to it at once,
+ * along with the `retriever_ctx` of `usearch_set_node_retriever`, so that the external storage can start
+ * reading them together. The nodes themselves are still obtained through the regular retriever afterwards.
+ */
+USEARCH_EXPORT void usearch_set_node_retriever_batch(usearch_index_t, usearch_node_retriever_batch_t retriever_batch,
+                                                     usearch_error_t* error);
 USEARCH_EXPORT void usearch_add_external(                                                                 //
     usearch_index_t index, usearch_key_t key, void const* vector, void* tape, usearch_scalar_kind_t kind, //
     int16_t level, uint64_t slot, usearch_error_t* error);
 
+/**
+ * @brief Replaces the vector of the node in the given @p slot of the externally managed index in place,
+ * just like `usearch_update`, but without looking up the key.
+ */
+USEARCH_EXPORT void usearch_update_external(                                                  //
+    usearch_index_t index, usearch_key_t key, void const* vector, usearch_scalar_kind_t kind, //
+    uint64_t slot, usearch_error_t* error);
+
 /**
  *  @brief Multi-threaded exact nearest neighbors search for equi-dimensional vectors.
  *  @param[in] dataset Pointer to the first scalar of the dataset matrix.
@@ -383,6 +678,24 @@ USEARCH_EXPORT void usearch_exact_search(                            //
     usearch_distance_t* distances, size_t distances_stride,          //
     usearch_error_t* error);
 
+/**
+ *  @brief Multi-threaded training of a product quantization codebook with mini-batch k-means.
+ *  The result can be passed as the `codebook` of an index, initialized with the same
+ *  `num_centroids` and `num_subvectors` options.
+ *  @param[in] vectors Pointer to `count` contiguous training vectors of `dimensions` floats.
+ *  @param[in] count Number of training vectors, at least `num_centroids`.
+ *  @param[in] dimensions The number of dimensions in each vector.
+ *  @param[in] num_centroids Number of centroids per subspace, up to 256.
+ *  @param[in] num_subvectors Number of subspaces, must divide `dimensions`.
+ *  @param[in] threads Upper bound for the number of CPU threads to use.
+ *  @param[out] codebook Output buffer for `num_centroids * dimensions` floats.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_train_codebook(                              //
+    float const* vectors, size_t count, size_t dimensions,              //
+    size_t num_centroids, size_t num_subvectors, size_t threads,        //
+    float* codebook, usearch_error_t* error);
+
 USEARCH_EXPORT void usearch_cast(usearch_scalar_kind_t from, void const* vector, usearch_scalar_kind_t to, void* result,
                                  size_t result_size, int dims, usearch_error_t* error);
 #ifdef __cplusplus
@@ -336,8 +336,74 @@ void search_many( //
     }
 }
 
+/**
+ *  Alternates insertions of @p n vectors with searches for the @p queries, so that readers and writers
+ *  contend for the same nodes, to measure the throughput of mixed workloads.
+ */
+template <typename index_at, typename vector_id_at, typename real_at>
+void index_and_search_mixed( //
+    index_at& index, std::size_t n, vector_id_at const* ids, real_at const* vectors, std::size_t queries_count,
+    real_at const* queries, std::size_t dims, std::size_t wanted) {
+
+    running_stats_printer_t printer{n * 2, "Mixed indexing and search"};
+
+#if USEARCH_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 32)
+#endif
+    for (std::size_t i = 0; i < n * 2; ++i) {
+        std::size_t thread = 0;
+#if USEARCH_USE_OPENMP
+        thread = omp_get_thread_num();
+#endif
+        if (i % 2 == 0) {
+            float_span_t vector{vectors + dims * (i / 2), dims};
+            typename index_at::add_result_t res = index.add(ids[i / 2], vector, thread);
+            printer.comparisons += res.computed_distances;
+            printer.visited_members += res.visited_members;
+        } else {
+            float_span_t query{queries + dims * ((i / 2) % queries_count), dims};
+            typename index_at::search_result_t res = index.search(query, wanted, thread);
+            printer.comparisons += res.computed_distances;
+            printer.visited_members += res.visited_members;
+        }
+        printer.progress++;
+        if (thread == 0)
+            printer.refresh();
+    }
+}
+
+template <typename index_at, typename vector_id_at, typename real_at>
+void search_batched( //
+    index_at& index, std::size_t n, real_at const* vectors, std::size_t dims, std::size_t wanted, vector_id_at* ids,
+    real_at* distances) {
+
+    constexpr std::size_t batch_size_k = 1024;
+    std::string name = "Batched search " + std::to_string(wanted);
+    running_stats_printer_t printer{n, name.c_str()};
+    std::vector<std::size_t> counts(n);
+
+#if USEARCH_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (std::size_t batch_start = 0; batch_start < n; batch_start += batch_size_k) {
+        std::size_t thread = 0;
+#if USEARCH_USE_OPENMP
+        thread = omp_get_thread_num();
+#endif
+        std::size_t batch_count = (std::min)(batch_size_k, n - batch_start);
+        typename index_at::search_batch_result_t res =
+            index.search_many(vectors + dims * batch_start, batch_count, wanted, ids + wanted * batch_start,
+                              distances + wanted * batch_start, counts.data() + batch_start, thread);
+        printer.comparisons += res.computed_distances;
+        printer.visited_members += res.visited_members;
+        printer.progress += batch_count;
+        if (thread == 0)
+            printer.refresh();
+    }
+}
+
 template <typename dataset_at, typename index_at> //
-static void single_shot(dataset_at& dataset, index_at& index, bool construct = true) {
+static void single_shot(dataset_at& dataset, index_at& index, bool construct = true, bool mixed = false) {
     using distance_t = typename index_at::distance_t;
 
     std::printf("\n");
@@ -346,7 +412,14 @@ static void single_shot(dataset_at& dataset, index_at& index, bool construct = t
         // Perform insertions, evaluate speed
         std::vector<default_key_t> ids(dataset.vectors_count());
         std::iota(ids.begin(), ids.end(), 0);
-        index_many(index, dataset.vectors_count(), ids.data(), dataset.vector(0), dataset.dimensions());
+        std::size_t const indexed = mixed ? dataset.vectors_count() / 2 : dataset.vectors_count();
+        index_many(index, indexed, ids.data(), dataset.vector(0), dataset.dimensions());
+
+        // Insert the rest of the vectors, while searching concurrently
+        if (mixed)
+            index_and_search_mixed(index, dataset.vectors_count() - indexed, ids.data() + indexed,
+                                   dataset.vector(indexed), dataset.queries_count(), dataset.query(0),
+                                   dataset.dimensions(), dataset.neighborhood_size());
     }
 
     // Perform search, evaluate speed
@@ -366,6 +439,20 @@ static void single_shot(dataset_at& dataset, index_at& index, bool construct = t
 
     std::printf("Recall@1 %.2f %%\n", recall_at_1 * 100.f / dataset.queries_count());
     std::printf("Recall@%ld %.2f %%\n", dataset.neighborhood_size(), recall_full * 100.f / dataset.queries_count());
+
+    // Repeat the search in batches, sharing the upper-level traversal, and compare to one-by-one results
+    std::vector<default_key_t> batched_neighbors(found_neighbors.size());
+    std::vector<distance_t> batched_distances(found_distances.size());
+    search_batched(index, dataset.queries_count(), dataset.query(0), dataset.dimensions(),
+                   dataset.neighborhood_size(), batched_neighbors.data(), batched_distances.data());
+
+    std::size_t batched_matches = 0;
+    for (std::size_t i = 0; i != dataset.queries_count(); ++i) {
+        auto begin = i * dataset.neighborhood_size(), end = begin + dataset.neighborhood_size();
+        batched_matches += std::equal(found_neighbors.begin() + begin, found_neighbors.begin() + end,
+                                      batched_neighbors.begin() + begin);
+    }
+    std::printf("Batched results match %.2f %%\n", batched_matches * 100.f / dataset.queries_count());
 }
 
 void handler(int sig) {
@@ -433,6 +520,9 @@ struct args_t {
     bool skip_pruned = false;
 
     bool pq = false;
+    bool arena = false;
+    bool colocated = false;
+    bool mixed = false;
     std::size_t num_centroids = 250;
     std::size_t num_subvectors = 32;
 
@@ -490,8 +580,10 @@ void run_punned(dataset_at& dataset, args_t const& args, index_config_t config,
     metric_punned_t metric(dataset.dimensions(), kind, quantization);
     storage_options opts;
     opts.dimensions = metric.dimensions();
-    opts.scalar_bits = bits_per_scalar(quantization) / 8;
+    opts.scalar_bits = bits_per_scalar(quantization);
     opts.pq = args.pq;
+    opts.arena = args.arena;
+    opts.colocated = args.colocated;
     opts.num_subvectors = args.num_subvectors;
     opts.num_centroids = args.num_centroids;
 
@@ -511,16 +603,18 @@ void run_punned(dataset_at& dataset, args_t const& args, index_config_t config,
     index.reserve(limits);
     std::printf("-- type: %s\n", typeid(index).name());
     std::printf("-- PQ: %s\n", args.pq ? "true" : "false");
+    std::printf("-- Arena: %s\n", args.arena ? "true" : "false");
+    std::printf("-- Co-located vectors: %s\n", args.colocated ? "true" : "false");
     if (args.pq) {
         std::printf("-- Num subvectors: %ld\n", args.num_subvectors);
         std::printf("-- Num centroids: %ld\n", args.num_centroids);
     }
-    std::printf("-- Scalar Bytes %ld\n", opts.scalar_bits);
+    std::printf("-- Scalar Bits %ld\n", opts.scalar_bits);
     std::printf("-- Hardware concurrency: %d\n", std::thread::hardware_concurrency());
     std::printf("-- Hardware acceleration: %s\n", index.metric().isa_name());
     std::printf("Will benchmark in-memory\n");
 
-    single_shot(dataset, index, true);
+    single_shot(dataset, index, true, args.mixed);
     index.save(args.path_output.c_str());
 }
 
@@ -559,8 +653,11 @@ int main(int argc, char** argv) {
         (option("--usearch-storage").set(args.usearch_storage))
             .doc("Use usearch storage in stead of default lantern one"),
         (option("-visits-container") & value("character", args.visits_container))
-            .doc("Use (B)itset, std::(U)nordered_set, or custom (G)rowing hash set"),
+            .doc("Use (B)itset, std::(U)nordered_set, custom (G)rowing hash set, or (E)poch-stamped slots"),
         (option("--pq").set(args.pq)).doc("Create a product-quantized (PQ) index"),
+        (option("--arena").set(args.arena)).doc("Allocate nodes and vectors of lantern storage from arenas"),
+        (option("--colocated").set(args.colocated)).doc("Store vectors in the same blocks as their nodes"),
+        (option("--mixed").set(args.mixed)).doc("Search concurrently with inserting the second half of vectors"),
         (option("--num_subvectors") & value("integer", args.num_subvectors)).doc("Number of subvectors for PQ"),
         (option("--num_centroids") & value("integer", args.num_centroids)).doc("Number of centroids for PQ"),
         (option("-j", "--threads") & value("integer", args.threads)).doc("Uses all available cores by default"),
@@ -655,7 +752,9 @@ int main(int argc, char** argv) {
             else if (args.visits_container == 'G') {
                 run_punned<index_dense_gt<default_key_t, uint32_t, default_storage_v2_t, 'G'>>(dataset, args, config,
                                                                                                limits);
-            }
+            } else if (args.visits_container == 'E')
+                run_punned<index_dense_gt<default_key_t, uint32_t, default_storage_v2_t, 'E'>>(dataset, args, config,
+                                                                                               limits);
         } else {
             if (args.visits_container == 'B')
                 run_punned<index_dense_gt<default_key_t, lantern_slot_t, lantern_internal_storage_t, 'B'>>(
@@ -666,7 +765,9 @@ int main(int argc, char** argv) {
             else if (args.visits_container == 'G') {
                 run_punned<index_dense_gt<default_key_t, lantern_slot_t, lantern_internal_storage_t, 'G'>>(
                     dataset, args, config, limits);
-            }
+            } else if (args.visits_container == 'E')
+                run_punned<index_dense_gt<default_key_t, lantern_slot_t, lantern_internal_storage_t, 'E'>>(
+                    dataset, args, config, limits);
         }
     }
 
@@ -0,0 +1,128 @@
+/**
+ *  @file       bench_metrics.cpp
+ *  @brief      Micro-benchmark for the distance kernels of `metric_punned_t`.
+ *
+ *  Compares the kernels picked at runtime by `metric_punned_t` against the portable
+ *  auto-vectorized `metric_ip_gt`, `metric_cos_gt`, and `metric_l2sq_gt` fallbacks,
+ *  reporting the time per distance and the largest relative deviation between them.
+ *
+ *  Usage: `bench_metrics_cpp [vectors] [rounds]`.
+ */
+#include <algorithm> // `std::max`
+#include <chrono>   // `std::chrono::steady_clock`
+#include <cmath>    // `std::fabs`
+#include <cstdio>   // `std::printf`
+#include <cstdlib>  // `std::strtoul`
+#include <random>   // `std::mt19937`
+#include <vector>   // `std::vector`
+
+#include <usearch/index_plugins.hpp>
+
+using namespace unum::usearch;
+
+using bench_clock_t = std::chrono::steady_clock;
+
+struct bench_result_t {
+    double fallback_ns{};
+    double native_ns{};
+    double max_relative_error{};
+    char const* isa{};
+};
+
+/**
+ *  @brief  Fallback kernel, kept out of line to be called through a pointer,
+ *          just like `metric_punned_t` calls its kernels.
+ */
+template <typename metric_at>
+__attribute__((noinline)) distance_punned_t fallback_(byte_t const* a, byte_t const* b, std::size_t dim) noexcept {
+    using scalar_t = typename metric_at::scalar_t;
+    return metric_at{}((scalar_t const*)a, (scalar_t const*)b, dim);
+}
+
+template <typename scalar_at> scalar_at random_scalar_(std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    return scalar_at(distribution(generator));
+}
+
+template <> i8_t random_scalar_<i8_t>(std::mt19937& generator) {
+    std::uniform_int_distribution<int> distribution(-128, 127);
+    return static_cast<i8_t>(distribution(generator));
+}
+
+template <typename scalar_at, typename fallback_at>
+bench_result_t bench_(metric_kind_t kind, std::size_t dimensions, std::size_t count, std::size_t rounds) {
+
+    std::mt19937 generator(42);
+    std::vector<scalar_at> vectors(count * dimensions);
+    for (scalar_at& scalar : vectors)
+        scalar = random_scalar_<scalar_at>(generator);
+
+    metric_punned_t metric(dimensions, kind, scalar_kind<scalar_at>());
+    byte_t const* data = (byte_t const*)vectors.data();
+    std::size_t stride = dimensions * sizeof(scalar_at);
+    auto fallback = &fallback_<fallback_at>;
+
+    bench_result_t result;
+    result.isa = metric.isa_name();
+
+    // Compare the outputs once, then time each of the kernels over the same pairs
+    for (std::size_t i = 0; i + 1 < count; ++i) {
+        byte_t const* a = data + i * stride;
+        byte_t const* b = data + (i + 1) * stride;
+        double expected = fallback(a, b, dimensions);
+        double received = metric(a, b);
+        double error = std::fabs(expected - received) / (std::fabs(expected) + 1e-6);
+        result.max_relative_error = (std::max)(result.max_relative_error, error);
+    }
+
+    distance_punned_t checksum = 0;
+    std::size_t pairs = (count - 1) * rounds;
+    auto start = bench_clock_t::now();
+    for (std::size_t round = 0; round != rounds; ++round)
+        for (std::size_t i = 0; i + 1 < count; ++i)
+            checksum += fallback(data + i * stride, data + (i + 1) * stride, dimensions);
+    auto middle = bench_clock_t::now();
+    for (std::size_t round = 0; round != rounds; ++round)
+        for (std::size_t i = 0; i + 1 < count; ++i)
+            checksum += metric(data + i * stride, data + (i + 1) * stride);
+    auto end = bench_clock_t::now();
+
+    result.fallback_ns = std::chrono::duration<double, std::nano>(middle - start).count() / pairs;
+    result.native_ns = std::chrono::duration<double, std::nano>(end - middle).count() / pairs;
+    if (checksum != checksum)
+        std::printf("Non-finite distances encountered\n");
+    return result;
+}
+
+template <typename scalar_at>
+void bench_scalar_(char const* scalar_name, std::size_t count, std::size_t rounds) {
+    static std::size_t const dimensions[] = {96, 100, 768, 1536};
+    for (std::size_t dims : dimensions) {
+        bench_result_t results[3] = {
+            bench_<scalar_at, metric_ip_gt<scalar_at, f32_t>>(metric_kind_t::ip_k, dims, count, rounds),
+            bench_<scalar_at, metric_cos_gt<scalar_at, f32_t>>(metric_kind_t::cos_k, dims, count, rounds),
+            bench_<scalar_at, metric_l2sq_gt<scalar_at, f32_t>>(metric_kind_t::l2sq_k, dims, count, rounds),
+        };
+        char const* metric_names[3] = {"ip", "cos", "l2sq"};
+        for (std::size_t i = 0; i != 3; ++i)
+            std::printf("%-4s %-5s %5zu | %8.2f ns %8.2f ns | %5.2fx | %.1e | %s\n", scalar_name, metric_names[i],
+                        dims, results[i].fallback_ns, results[i].native_ns,
+                        results[i].fallback_ns / results[i].native_ns, results[i].max_relative_error,
+                        results[i].isa);
+    }
+}
+
+int main(int argc, char** argv) {
+    std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1024;
+    std::size_t rounds = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 100;
+    if (count < 2 || !rounds) {
+        std::printf("Usage: %s [vectors >= 2] [rounds >= 1]\n", argv[0]);
+        return 1;
+    }
+
+    std::printf("type metric  dims |  fallback    native |  speed | max err | isa\n");
+    bench_scalar_<f32_t>("f32", count, rounds);
+    bench_scalar_<f16_t>("f16", count, rounds);
+    bench_scalar_<i8_t>("i8", count, rounds);
+    return 0;
+}
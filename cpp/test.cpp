@@ -2,9 +2,12 @@
  * @brief A trivial test.
  */
 #include <algorithm> // `std::shuffle`
+#include <atomic>    // `std::atomic`
 #include <cassert>   // `assert`
+#include <numeric>   // `std::iota`
 #include <random>    // `std::default_random_engine`
 #include <stdexcept>
+#include <thread> // `std::thread`
 #include <vector> // for std::vector
 
 #include <usearch/index.hpp>
@@ -20,6 +23,47 @@ void expect(bool must_be_true) {
         throw std::runtime_error("Failed!");
 }
 
+using lantern_index_t = index_dense_gt<default_key_t, lantern_slot_t, lantern_internal_storage_t>;
+
+std::vector<float> random_matrix(std::size_t count, std::size_t dimensions) {
+    std::vector<float> matrix(count * dimensions);
+    std::generate(matrix.begin(), matrix.end(), [] { return float(std::rand()) / float(RAND_MAX); });
+    return matrix;
+}
+
+/**
+ *  @brief  Makes a dense index over internal lantern storage, product-quantized if a @p codebook of
+ *          @p num_centroids vectors is passed, with every vector split into @p num_subvectors parts.
+ */
+lantern_index_t make_lantern_index(std::size_t dimensions, metric_kind_t kind, std::size_t threads = 1,
+                                   float const* codebook = nullptr, std::size_t num_centroids = 0,
+                                   std::size_t num_subvectors = 0, index_dense_config_t config = {}) {
+    storage_options opts{};
+    opts.dimensions = dimensions;
+    opts.scalar_bits = bits_per_scalar(scalar_kind_t::f32_k);
+    opts.pq = codebook != nullptr;
+    opts.num_centroids = num_centroids;
+    opts.num_subvectors = num_subvectors;
+    metric_punned_t metric(dimensions, kind, scalar_kind_t::f32_k);
+    lantern_index_t index = lantern_index_t::make(metric, opts, threads, config, codebook);
+    expect(bool(index));
+    return index;
+}
+
+/// Checks that two indexes return the same keys at the same distances for every query
+void expect_same_results(lantern_index_t const& a, lantern_index_t const& b, float const* queries,
+                         std::size_t queries_count, std::size_t dimensions, std::size_t wanted) {
+    std::vector<default_key_t> a_keys(wanted), b_keys(wanted);
+    std::vector<float> a_distances(wanted), b_distances(wanted);
+    for (std::size_t i = 0; i != queries_count; ++i) {
+        std::size_t a_count = a.search(queries + i * dimensions, wanted).dump_to(a_keys.data(), a_distances.data());
+        std::size_t b_count = b.search(queries + i * dimensions, wanted).dump_to(b_keys.data(), b_distances.data());
+        expect(a_count == b_count);
+        expect(std::equal(a_keys.begin(), a_keys.begin() + a_count, b_keys.begin()));
+        expect(std::equal(a_distances.begin(), a_distances.begin() + a_count, b_distances.begin()));
+    }
+}
+
 template <bool punned_ak, typename index_at, typename scalar_at, typename... extra_args_at>
 void test_cosine(index_at& index, std::vector<std::vector<scalar_at>> const& vectors, extra_args_at&&... args) {
 
@@ -278,6 +322,407 @@ void test_exact_search(std::size_t dataset_count, std::size_t queries_count, std
         assert(results.at(i)[0].offset == i); // Validate the top match
 }
 
+/**
+ *  The shared pool must run every task exactly once, on valid thread indices, stop scheduling tasks
+ *  once one of them fails, and complete calls coming from several threads at once.
+ */
+void test_executor_pool(std::size_t threads) {
+    executor_pool_t executor(threads);
+    std::size_t const tasks = 10000;
+
+    std::vector<std::atomic<std::size_t>> calls(tasks);
+    std::atomic<bool> valid_threads{true};
+    executor.fixed(tasks, [&](std::size_t thread_idx, std::size_t task_idx) {
+        valid_threads = valid_threads && thread_idx < threads;
+        ++calls[task_idx];
+    });
+    expect(valid_threads);
+    expect(std::all_of(calls.begin(), calls.end(), [](std::atomic<std::size_t> const& c) { return c == 1; }));
+
+    // Every thread stops after its first failed task
+    std::atomic<std::size_t> dynamic_calls{0};
+    executor.dynamic(tasks, [&](std::size_t, std::size_t) {
+        ++dynamic_calls;
+        return false;
+    });
+    expect(dynamic_calls >= 1 && dynamic_calls <= threads);
+
+    std::vector<std::atomic<std::size_t>> thread_calls(threads);
+    executor.parallel([&](std::size_t thread_idx) { ++thread_calls[thread_idx]; });
+    expect(std::all_of(thread_calls.begin(), thread_calls.end(),
+                       [](std::atomic<std::size_t> const& c) { return c == 1; }));
+
+    // Exceptions are rethrown on the calling thread
+    bool thrown = false;
+    try {
+        executor.fixed(tasks, [](std::size_t, std::size_t task_idx) {
+            if (task_idx == tasks / 2)
+                throw std::runtime_error("Task failed");
+        });
+    } catch (std::runtime_error const&) {
+        thrown = true;
+    }
+    expect(thrown);
+
+    // Concurrent callers share the same workers
+    std::atomic<std::size_t> concurrent_calls{0};
+    std::vector<std::thread> callers;
+    for (std::size_t caller = 0; caller != 4; ++caller)
+        callers.emplace_back([&] { executor.fixed(tasks, [&](std::size_t, std::size_t) { ++concurrent_calls; }); });
+    for (std::thread& caller : callers)
+        caller.join();
+    expect(concurrent_calls == 4 * tasks);
+}
+
+/**
+ *  Writers holding a sequence lock must exclude each other, and readers must never validate a read,
+ *  that overlapped with a write. Then the same must hold for the nodes of an index, that is searched
+ *  while new vectors are being inserted.
+ */
+void test_seqlocks(std::size_t threads) {
+    seqlocks_gt<> locks(2);
+    std::size_t const rounds = 20000;
+
+    // Every write keeps both halves equal, so a torn read would see them differ
+    std::atomic<std::size_t> first{0}, second{0};
+    std::atomic<std::size_t> torn_reads{0}, valid_reads{0};
+    std::vector<std::thread> workers;
+    for (std::size_t worker = 0; worker != threads; ++worker)
+        workers.emplace_back([&, worker] {
+            for (std::size_t round = 0; round != rounds; ++round) {
+                if (worker % 2 == 0) {
+                    locks.lock(1);
+                    std::size_t value = first.load(std::memory_order_relaxed) + 1;
+                    first.store(value, std::memory_order_relaxed);
+                    std::this_thread::yield();
+                    second.store(value, std::memory_order_relaxed);
+                    locks.unlock(1);
+                    continue;
+                }
+                seqlocks_gt<>::version_t version = locks.read_begin(1);
+                std::size_t first_copy = first.load(std::memory_order_relaxed);
+                std::size_t second_copy = second.load(std::memory_order_relaxed);
+                if (!locks.read_validate(1, version))
+                    continue;
+                ++valid_reads;
+                torn_reads += first_copy != second_copy;
+            }
+        });
+    for (std::thread& worker : workers)
+        worker.join();
+    std::size_t const writers = (threads + 1) / 2;
+    expect(first == writers * rounds && second == writers * rounds);
+    expect(torn_reads == 0);
+    expect(threads == 1 || valid_reads != 0);
+
+    // Half of the vectors are inserted before, and the other half during the searches
+    std::size_t const count = 2000, dimensions = 16;
+    std::vector<float> vectors = random_matrix(count, dimensions);
+    lantern_index_t index = make_lantern_index(dimensions, metric_kind_t::l2sq_k, threads);
+    index.reserve(index_limits_t(count, threads));
+    for (std::size_t i = 0; i != count / 2; ++i)
+        expect(bool(index.add(i, vectors.data() + i * dimensions, 0)));
+    std::atomic<std::size_t> next{count / 2};
+    std::atomic<bool> failed{false};
+    workers.clear();
+    for (std::size_t thread = 0; thread != threads; ++thread)
+        workers.emplace_back([&, thread] {
+            default_key_t key;
+            for (std::size_t i = next++; i < count; i = next++) {
+                failed = failed || !index.add(i, vectors.data() + i * dimensions, thread);
+                std::size_t query = i % (count / 2);
+                failed = failed || index.search(vectors.data() + query * dimensions, 1, thread).dump_to(&key) != 1;
+            }
+        });
+    for (std::thread& worker : workers)
+        worker.join();
+    expect(!failed && index.size() == count);
+}
+
+/**
+ *  Inserting a batch with `add_many` must build exactly the same graph as adding the vectors one by one,
+ *  with or without product quantization, where the whole batch is encoded at once.
+ */
+void test_add_many(std::size_t count, std::size_t dimensions, bool pq) {
+    std::vector<float> vectors = random_matrix(count, dimensions);
+    std::vector<default_key_t> keys(count);
+    std::iota(keys.begin(), keys.end(), 100);
+
+    // Use the leading vectors as centroids, to avoid training a codebook
+    std::size_t const num_centroids = 16, num_subvectors = 4;
+    float const* codebook = pq ? vectors.data() : nullptr;
+    lantern_index_t one_by_one =
+        make_lantern_index(dimensions, metric_kind_t::l2sq_k, 1, codebook, num_centroids, num_subvectors);
+    lantern_index_t batched =
+        make_lantern_index(dimensions, metric_kind_t::l2sq_k, 1, codebook, num_centroids, num_subvectors);
+    one_by_one.reserve(count);
+    batched.reserve(count);
+
+    for (std::size_t i = 0; i != count; ++i)
+        expect(bool(one_by_one.add(keys[i], vectors.data() + i * dimensions)));
+    expect(bool(batched.add_many(keys.data(), vectors.data(), count)));
+    expect(batched.size() == count);
+    expect(batched.count(keys[count - 1]) == 1);
+    expect_same_results(one_by_one, batched, vectors.data(), count, dimensions, 10);
+}
+
+/**
+ *  Inserting a strided batch with `add_many` on several threads must add every vector exactly once,
+ *  building a graph where almost every vector finds itself.
+ */
+void test_add_many_parallel(std::size_t count, std::size_t dimensions, std::size_t threads) {
+    // Every row is followed by a few scalars of padding, skipped with the stride
+    std::size_t const row = dimensions + 3;
+    std::vector<float> vectors = random_matrix(count, row);
+    std::vector<default_key_t> keys(count);
+    std::iota(keys.begin(), keys.end(), 100);
+
+    lantern_index_t index = make_lantern_index(dimensions, metric_kind_t::l2sq_k, threads);
+    executor_default_t executor(threads);
+    expect(bool(index.add_many(keys.data(), vectors.data(), count, row * sizeof(float), executor)));
+    expect(index.size() == count);
+
+    std::size_t found = 0;
+    default_key_t key;
+    for (std::size_t i = 0; i != count; ++i) {
+        expect(index.count(keys[i]) == 1);
+        found += index.search(vectors.data() + i * row, 1).dump_to(&key) == 1 && key == keys[i];
+    }
+    expect(found >= count * 95 / 100);
+}
+
+/**
+ *  Removed entries must disappear from the results at once, and once a large enough batch is removed,
+ *  or `isolate` is called, the graph must be repaired around them, and their slots reused by insertions.
+ */
+void test_remove(std::size_t count, std::size_t dimensions, std::size_t threads) {
+    std::vector<float> vectors = random_matrix(2 * count, dimensions);
+    lantern_index_t index = make_lantern_index(dimensions, metric_kind_t::l2sq_k, threads);
+    index.reserve(index_limits_t(count, threads));
+    for (std::size_t i = 0; i != count; ++i)
+        expect(bool(index.add(i, vectors.data() + i * dimensions)));
+
+    // A single removal is only queued for the repair, and its slot is reused after `isolate`
+    default_key_t key;
+    expect(index.remove(0).completed == 1);
+    expect(index.remove(0).completed == 0);
+    expect(index.size() == count - 1 && !index.count(0));
+    expect(index.search(vectors.data(), 1).dump_to(&key) == 1 && key != 0);
+    lantern_index_t::add_result_t overflow = index.add(count, vectors.data() + count * dimensions);
+    expect(!overflow);
+    overflow.error.release();
+    expect(bool(index.isolate()));
+    expect(bool(index.add(count, vectors.data() + count * dimensions)));
+
+    // Removing a quarter of the entries at once repairs the graph right away
+    std::size_t const removed = count / 4;
+    std::vector<default_key_t> keys(removed);
+    std::iota(keys.begin(), keys.end(), 1);
+    executor_default_t executor(threads);
+    expect(index.remove(keys.begin(), keys.end(), executor).completed == removed);
+    expect(index.size() == count - removed);
+
+    // The remaining entries must still find themselves, never reaching the removed ones
+    std::size_t found = 0;
+    for (std::size_t i = removed + 1; i <= count; ++i) {
+        expect(index.search(vectors.data() + i * dimensions, 1).dump_to(&key) == 1);
+        expect(key > removed);
+        found += key == i;
+    }
+    expect(found >= (count - removed) * 95 / 100);
+
+    // The freed slots must be reused, without growing the capacity
+    for (std::size_t i = count + 1; i <= count + removed; ++i)
+        expect(bool(index.add(i, vectors.data() + i * dimensions)));
+    expect(index.size() == count && index.capacity() == count);
+    found = 0;
+    for (std::size_t i = count + 1; i <= count + removed; ++i)
+        found += index.search(vectors.data() + i * dimensions, 1).dump_to(&key) == 1 && key == i;
+    expect(found >= removed * 95 / 100);
+}
+
+/**
+ *  Replacing every vector in place, from several threads at once, so that neighboring entries are updated
+ *  concurrently, must keep every key in its slot, and relink it, so it's found by the new vector.
+ */
+void test_update(std::size_t count, std::size_t dimensions, std::size_t threads) {
+    std::vector<float> vectors = random_matrix(2 * count, dimensions);
+    float const* old_vectors = vectors.data();
+    float const* new_vectors = vectors.data() + count * dimensions;
+    lantern_index_t index = make_lantern_index(dimensions, metric_kind_t::l2sq_k, threads);
+    index.reserve(index_limits_t(count, threads));
+    for (std::size_t i = 0; i != count; ++i)
+        expect(bool(index.add(i, old_vectors + i * dimensions)));
+
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> workers;
+    for (std::size_t thread = 0; thread != threads; ++thread)
+        workers.emplace_back([&, thread] {
+            for (std::size_t i = thread; i < count; i += threads)
+                failed = failed || !index.update(i, new_vectors + i * dimensions, thread);
+        });
+    for (std::thread& worker : workers)
+        worker.join();
+    expect(!failed && index.size() == count);
+
+    std::size_t found = 0;
+    default_key_t key;
+    float distance;
+    for (std::size_t i = 0; i != count; ++i) {
+        expect(index.count(i) == 1);
+        found += index.search(new_vectors + i * dimensions, 1).dump_to(&key, &distance) == 1 && key == i;
+    }
+    expect(found >= count * 95 / 100);
+
+    // The old content must be gone, rather than left behind as another entry
+    expect(index.search(old_vectors, 1).dump_to(&key, &distance) == 1 && distance > 0);
+}
+
+/**
+ *  Filtered search must only return the entries passing the predicate, whether they are few enough
+ *  to be compared exhaustively, or many enough to traverse the graph through them, and must find
+ *  about the same matches as comparing every passing entry with the query.
+ */
+void test_filtered_search(std::size_t count, std::size_t dimensions) {
+    std::vector<float> vectors = random_matrix(count, dimensions);
+    lantern_index_t index = make_lantern_index(dimensions, metric_kind_t::l2sq_k);
+    index.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+        expect(bool(index.add(i, vectors.data() + i * dimensions)));
+
+    // Counts the matches shared with the exhaustive search over the passing entries,
+    // testing either the keys or the slots, that are the same here, as the vectors were added in order
+    std::size_t const wanted = 10, queries = 50;
+    auto expect_filtered = [&](auto&& passes, bool by_slot, std::size_t passing, double selectivity) {
+        auto predicate = [&](lantern_index_t::member_cref_t const& member) {
+            return passes(by_slot ? std::size_t(member.slot) : std::size_t(member.key));
+        };
+        index_search_config_t config;
+        config.selectivity = selectivity;
+        std::size_t found = 0;
+        for (std::size_t q = 0; q != queries; ++q) {
+            float const* query = vectors.data() + (q * 37 % count) * dimensions;
+            std::vector<std::pair<float, default_key_t>> exact;
+            for (std::size_t i = 0; i != count; ++i) {
+                if (!passes(i))
+                    continue;
+                float distance = 0;
+                for (std::size_t d = 0; d != dimensions; ++d)
+                    distance += (query[d] - vectors[i * dimensions + d]) * (query[d] - vectors[i * dimensions + d]);
+                exact.emplace_back(distance, i);
+            }
+            std::sort(exact.begin(), exact.end());
+            exact.resize((std::min)(exact.size(), wanted));
+
+            std::vector<default_key_t> keys(wanted);
+            lantern_index_t::search_result_t result = index.filtered_search(query, wanted, predicate, config);
+            expect(bool(result));
+            std::size_t const matched = result.dump_to(keys.data());
+            expect(matched == (std::min)(passing, wanted));
+            for (std::size_t i = 0; i != matched; ++i) {
+                expect(passes(keys[i]));
+                for (auto const& match : exact)
+                    found += match.second == keys[i];
+            }
+        }
+        return found;
+    };
+
+    auto even = [](std::size_t key) { return key % 2 == 0; };
+    auto rare = [](std::size_t key) { return key % 100 == 0; };
+    auto few = [](std::size_t key) { return key < 5; };
+    auto none = [](std::size_t) { return false; };
+    std::vector<unsigned char> bitmap((count + 7) / 8);
+    for (std::size_t slot = 0; slot < count; slot += 3)
+        bitmap[slot / 8] |= 1u << (slot % 8);
+    auto slots = [&](std::size_t slot) { return slot < count && (bitmap[slot / 8] & (1u << (slot % 8))); };
+
+    std::size_t const rare_count = (count + 99) / 100, slots_count = (count + 2) / 3;
+    expect(expect_filtered(even, false, count / 2, 0) >= queries * wanted * 9 / 10);
+    expect(expect_filtered(slots, true, slots_count, 0) >= queries * wanted * 9 / 10);
+    expect(expect_filtered(rare, false, rare_count, 0) == queries * wanted);
+    expect(expect_filtered(few, false, 5, 0) == queries * 5);
+    expect(expect_filtered(none, false, 0, 0) == 0);
+
+    // Overestimating the selectivity must still find all the passing entries, falling back to exhaustive search
+    expect(expect_filtered(few, false, 5, 1) == queries * 5);
+    expect(expect_filtered(even, false, count / 2, 0.5) >= queries * wanted * 9 / 10);
+}
+
+/**
+ *  Training on well-separated clusters must place a centroid into every cluster of every subspace,
+ *  and produce the same codebook for the same seed, no matter how many threads train it.
+ */
+void test_train_codebook(std::size_t threads) {
+    std::size_t const dimensions = 16, num_subvectors = 4, num_centroids = 8, count = 400;
+    std::size_t const subvector_dim = dimensions / num_subvectors;
+
+    // Every vector is one of the cluster centers, shifted by a little noise
+    std::vector<float> centers = random_matrix(num_centroids, dimensions);
+    std::vector<float> vectors = random_matrix(count, dimensions);
+    for (std::size_t i = 0; i != count; ++i)
+        for (std::size_t j = 0; j != dimensions; ++j)
+            vectors[i * dimensions + j] = 10 * centers[(i % num_centroids) * dimensions + j] +
+                                          0.01f * vectors[i * dimensions + j];
+
+    std::vector<float> codebook(num_centroids * dimensions), codebook_serial(num_centroids * dimensions);
+    executor_default_t executor(threads);
+    expect(bool(train_pq_codebook(vectors.data(), count, dimensions, num_centroids, num_subvectors,
+                                  codebook.data(), {}, executor)));
+    expect(bool(train_pq_codebook(vectors.data(), count, dimensions, num_centroids, num_subvectors,
+                                  codebook_serial.data(), {}, dummy_executor_t{})));
+    expect(codebook == codebook_serial);
+
+    float error = 0;
+    metric_l2sq_gt<float> l2sq;
+    for (std::size_t i = 0; i != count; ++i)
+        for (std::size_t offset = 0; offset != dimensions; offset += subvector_dim) {
+            float closest = std::numeric_limits<float>::max();
+            for (std::size_t c = 0; c != num_centroids; ++c)
+                closest = (std::min)(closest, l2sq(vectors.data() + i * dimensions + offset,
+                                                   codebook.data() + c * dimensions + offset, subvector_dim));
+            error += closest / count;
+        }
+    expect(error < 0.01f);
+
+    // Invalid shapes are reported rather than trained on
+    pq_training_result_t too_few = train_pq_codebook(vectors.data(), num_centroids - 1, dimensions, num_centroids,
+                                                     num_subvectors, codebook.data());
+    expect(!too_few);
+    too_few.error.release();
+    pq_training_result_t indivisible =
+        train_pq_codebook(vectors.data(), count, dimensions, num_centroids, 3, codebook.data());
+    expect(!indivisible);
+    indivisible.error.release();
+}
+
+/**
+ *  Vectors of an index, viewed from a buffer that isn't aligned, must be scored with unaligned loads,
+ *  by both the punned and the compile-time specialized metrics.
+ */
+void test_unaligned_vectors(std::size_t count, std::size_t dimensions) {
+    std::vector<float> vectors = random_matrix(count, dimensions);
+    lantern_index_t index = make_lantern_index(dimensions, metric_kind_t::l2sq_k);
+    index.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+        expect(bool(index.add(i, vectors.data() + i * dimensions)));
+
+    // Shifting the serialized index by one scalar puts all of its vectors off the alignment boundaries
+    std::size_t const length = index.serialized_length();
+    std::vector<byte_t> buffer(length + 2 * vector_alignment_k);
+    std::size_t const misalignment = reinterpret_cast<std::uintptr_t>(buffer.data()) % vector_alignment_k;
+    byte_t* data = buffer.data() + vector_alignment_k - misalignment + sizeof(float);
+    expect(bool(index.save(memory_mapped_file_t(data, length))));
+
+    lantern_index_t view = make_lantern_index(dimensions, metric_kind_t::l2sq_k);
+    expect(bool(view.view(memory_mapped_file_t(data, length))));
+    default_key_t key;
+    for (std::size_t i = 0; i != count; ++i) {
+        expect(view.search(vectors.data() + i * dimensions, 1).dump_to(&key) == 1);
+        expect(key == i);
+    }
+}
+
 template <typename index_at> void test_sets(index_at&& index) {
 
     using index_t = typename std::remove_reference<index_at>::type;
@@ -348,5 +793,38 @@ int main(int, char**) {
         for (std::size_t dimensions : {97, 256})
             test_tanimoto<std::int64_t, std::uint32_t>(dimensions, connectivity);
 
+    std::printf("Testing the executor pool\n");
+    for (std::size_t threads : {1, 3, 8})
+        test_executor_pool(threads);
+
+    std::printf("Testing sequence locks\n");
+    for (std::size_t threads : {1, 4})
+        test_seqlocks(threads);
+
+    std::printf("Testing batched insertions\n");
+    for (bool pq : {false, true})
+        test_add_many(300, 32, pq);
+    for (std::size_t threads : {1, 4})
+        test_add_many_parallel(1000, 32, threads);
+
+    std::printf("Testing removals\n");
+    for (std::size_t threads : {1, 4})
+        test_remove(1000, 32, threads);
+
+    std::printf("Testing updates\n");
+    for (std::size_t threads : {1, 4})
+        test_update(1000, 32, threads);
+
+    std::printf("Testing filtered search\n");
+    test_filtered_search(2000, 16);
+
+    std::printf("Testing codebook training\n");
+    for (std::size_t threads : {1, 4})
+        test_train_codebook(threads);
+
+    std::printf("Testing unaligned vectors\n");
+    for (std::size_t dimensions : {100, 128})
+        test_unaligned_vectors(200, dimensions);
+
     return 0;
 }
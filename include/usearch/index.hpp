@@ -136,6 +136,13 @@ inline std::size_t divide_round_up(std::size_t num, std::size_t denominator) noe
     return (num + denominator - 1) / denominator;
 }
 
+/// @brief  Hints the CPU to fetch every cache line of a contiguous range of @p length bytes.
+inline void prefetch_bytes(void const* begin, std::size_t length) noexcept {
+    (void)begin;
+    for (std::size_t offset = 0; offset < length; offset += 64)
+        prefetch_m(static_cast<byte_t const*>(begin) + offset);
+}
+
 inline std::size_t ceil2(std::size_t v) noexcept {
     v--;
     v |= v >> 1;
@@ -388,6 +395,37 @@ template <typename result_at> struct expected_gt {
     }
 };
 
+/// @brief  Hints the CPU, that the current thread is spinning in a busy-wait loop.
+inline void cpu_relax() noexcept {
+#if defined(USEARCH_DEFINED_WINDOWS)
+    YieldProcessor();
+#elif defined(USEARCH_DEFINED_X86)
+    __builtin_ia32_pause();
+#elif defined(USEARCH_DEFINED_ARM)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/**
+ *  @brief  Exponential backoff for busy-wait loops. Doubles the number of `cpu_relax` hints
+ *          on every call, and starts yielding the time slice once that number gets large.
+ */
+class backoff_t {
+    std::size_t pauses_ = 1;
+    static constexpr std::size_t max_pauses_k = 64;
+
+  public:
+    inline void pause() noexcept {
+        if (pauses_ > max_pauses_k) {
+            std::this_thread::yield();
+            return;
+        }
+        for (std::size_t i = 0; i != pauses_; ++i)
+            cpu_relax();
+        pauses_ *= 2;
+    }
+};
+
 /**
  *  @brief  Light-weight bitset implementation to sync nodes updates during graph mutations.
  *          Extends basic functionality with @b atomic operations.
@@ -434,6 +472,7 @@ template <typename allocator_at = std::allocator<byte_t>> class bitset_gt {
             (compressed_slot_t*)allocator_t{}.allocate(slots(capacity) * sizeof(compressed_slot_t));
         if (!new_slots)
             return false;
+        std::memset(new_slots + count_, 0, (slots(capacity) - count_) * sizeof(compressed_slot_t));
         if (slots_) {
             std::memcpy(new_slots, slots_, count_ * sizeof(compressed_slot_t));
             allocator_t{}.deallocate((byte_t*)slots_, count_ * sizeof(compressed_slot_t));
@@ -518,6 +557,180 @@ template <typename allocator_at = std::allocator<byte_t>> class bitset_gt {
 
 using bitset_t = bitset_gt<>;
 
+/**
+ *  @brief  Array of "sequence locks", one per node, that let readers copy the node without locking it.
+ *          Writers make the version odd while they hold the lock, and even again once they release it.
+ *          Readers copy the node between two loads of an even version, and retry if the version changed.
+ */
+template <typename allocator_at = std::allocator<byte_t>> class seqlocks_gt {
+    using allocator_t = allocator_at;
+    using byte_t = typename allocator_t::value_type;
+    static_assert(sizeof(byte_t) == 1, "Allocator must allocate separate addressable bytes");
+
+  public:
+    using version_t = std::uint32_t;
+
+  private:
+    using atomic_version_t = std::atomic<version_t>;
+
+    atomic_version_t* versions_{};
+    /// @brief Number of versioned slots.
+    std::size_t size_{};
+
+  public:
+    seqlocks_gt() noexcept {}
+    ~seqlocks_gt() noexcept { reset(); }
+
+    explicit operator bool() const noexcept { return versions_; }
+    std::size_t size() const noexcept { return size_; }
+
+    void reset() noexcept {
+        if (versions_)
+            allocator_t{}.deallocate((byte_t*)versions_, size_ * sizeof(atomic_version_t));
+        versions_ = nullptr;
+        size_ = 0;
+    }
+
+    seqlocks_gt(std::size_t size) noexcept
+        : versions_((atomic_version_t*)allocator_t{}.allocate(size * sizeof(atomic_version_t))),
+          size_(versions_ ? size : 0u) {
+        for (std::size_t i = 0; i != size_; ++i)
+            new (versions_ + i) atomic_version_t(0);
+    }
+
+    seqlocks_gt(seqlocks_gt&& other) noexcept {
+        // `std::exchange` is visible through the `std::atomic` argument, so we qualify the call
+        versions_ = usearch::exchange(other.versions_, nullptr);
+        size_ = usearch::exchange(other.size_, 0);
+    }
+
+    seqlocks_gt& operator=(seqlocks_gt&& other) noexcept {
+        std::swap(versions_, other.versions_);
+        std::swap(size_, other.size_);
+        return *this;
+    }
+
+    seqlocks_gt(seqlocks_gt const&) = delete;
+    seqlocks_gt& operator=(seqlocks_gt const&) = delete;
+
+    /// @brief Acquires the exclusive writer lock, backing off while another writer holds it.
+    inline void lock(std::size_t i) noexcept {
+        backoff_t backoff;
+        version_t version = versions_[i].load(std::memory_order_relaxed);
+        while ((version & 1) ||
+               !versions_[i].compare_exchange_weak(version, version + 1, std::memory_order_acquire,
+                                                   std::memory_order_relaxed)) {
+            backoff.pause();
+            version = versions_[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Releases the writer lock, publishing a new version to the readers.
+    inline void unlock(std::size_t i) noexcept { versions_[i].fetch_add(1, std::memory_order_release); }
+
+    /// @brief Waits until no writer holds the lock, and returns the version to validate the read against.
+    inline version_t read_begin(std::size_t i) const noexcept {
+        backoff_t backoff;
+        version_t version = versions_[i].load(std::memory_order_acquire);
+        while (version & 1) {
+            backoff.pause();
+            version = versions_[i].load(std::memory_order_acquire);
+        }
+        return version;
+    }
+
+    /// @brief Checks if the data read since `read_begin` returned @p version is consistent.
+    inline bool read_validate(std::size_t i, version_t version) const noexcept {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return versions_[i].load(std::memory_order_relaxed) == version;
+    }
+};
+
+/**
+ *  @brief  Set of visited slots, that stamps every slot with the epoch of the last query that visited it.
+ *          Unlike `bitset_gt`, clearing is O(1) - it just starts a new epoch, and the stamps are only
+ *          zeroed once in 65535 queries, when the epoch counter wraps around.
+ */
+template <typename allocator_at = std::allocator<byte_t>> class epoch_set_gt {
+    using allocator_t = allocator_at;
+    using byte_t = typename allocator_t::value_type;
+    static_assert(sizeof(byte_t) == 1, "Allocator must allocate separate addressable bytes");
+
+    using epoch_t = std::uint16_t;
+
+    /// @brief Epoch of the last visit of every slot, where zero means "never visited".
+    epoch_t* stamps_{};
+    /// @brief Number of slots.
+    std::size_t size_{};
+    /// @brief Epoch of the current query, always non-zero.
+    epoch_t epoch_{1};
+
+  public:
+    epoch_set_gt() noexcept {}
+    ~epoch_set_gt() noexcept { reset(); }
+
+    explicit operator bool() const noexcept { return stamps_; }
+    std::size_t size() const noexcept { return size_; }
+    void clear() noexcept {
+        if (++epoch_)
+            return;
+        if (stamps_)
+            std::memset(stamps_, 0, size_ * sizeof(epoch_t));
+        epoch_ = 1;
+    }
+
+    void reset() noexcept {
+        if (stamps_)
+            allocator_t{}.deallocate((byte_t*)stamps_, size_ * sizeof(epoch_t));
+        stamps_ = nullptr;
+        size_ = 0;
+        epoch_ = 1;
+    }
+
+    bool reserve(std::size_t capacity) {
+        if (capacity <= size_)
+            return true;
+        epoch_t* new_stamps = (epoch_t*)allocator_t{}.allocate(capacity * sizeof(epoch_t));
+        if (!new_stamps)
+            return false;
+        std::memset(new_stamps + size_, 0, (capacity - size_) * sizeof(epoch_t));
+        if (stamps_) {
+            std::memcpy(new_stamps, stamps_, size_ * sizeof(epoch_t));
+            allocator_t{}.deallocate((byte_t*)stamps_, size_ * sizeof(epoch_t));
+        }
+        stamps_ = new_stamps;
+        size_ = capacity;
+        return true;
+    }
+
+    epoch_set_gt(epoch_set_gt&& other) noexcept {
+        stamps_ = exchange(other.stamps_, nullptr);
+        size_ = exchange(other.size_, 0);
+        epoch_ = exchange(other.epoch_, 1);
+    }
+
+    epoch_set_gt& operator=(epoch_set_gt&& other) noexcept {
+        std::swap(stamps_, other.stamps_);
+        std::swap(size_, other.size_);
+        std::swap(epoch_, other.epoch_);
+        return *this;
+    }
+
+    epoch_set_gt(epoch_set_gt const&) = delete;
+    epoch_set_gt& operator=(epoch_set_gt const&) = delete;
+
+    inline bool test(std::size_t i) const noexcept { return stamps_[i] == epoch_; }
+
+    /**
+     *  @return Similar to `bitset_gt`, returns the previous value.
+     */
+    inline bool set(std::size_t i) noexcept {
+        bool value = stamps_[i] == epoch_;
+        stamps_[i] = epoch_;
+        return value;
+    }
+};
+
 /**
  *  @brief  Similar to `std::priority_queue`, but allows raw access to underlying
  *          memory, in case you want to shuffle it or sort. Good for collections
@@ -1244,6 +1457,11 @@ struct index_config_t {
     /// with some of the pruned neighbors to fill as many of node neighbor slots as possible
     bool skip_pruned_connections = false;
 
+    /// @brief Keeps an in-memory mirror of the nodes above the base level, including their vectors,
+    /// so that the greedy descent of a search doesn't fetch anything from the storage.
+    /// It costs roughly `1 / connectivity` of the memory of the nodes and vectors, and isn't serialized.
+    bool cache_upper_levels = false;
+
     inline index_config_t() = default;
     inline index_config_t(std::size_t c) noexcept
         : connectivity(c ? c : default_connectivity()), connectivity_base(c ? c * 2 : default_connectivity() * 2) {}
@@ -1283,6 +1501,13 @@ struct index_search_config_t {
 
     /// @brief Brute-forces exhaustive search over all entries in the index.
     bool exact = false;
+
+    /// @brief Upper bound on the distance to returned matches, farther ones are dropped.
+    double radius = std::numeric_limits<double>::max();
+
+    /// @brief Optional fraction of entries, expected to pass the predicate of a filtered search.
+    /// If zero, it is estimated by sampling the predicate on a few entries.
+    double selectivity = 0;
 };
 
 struct index_cluster_config_t {
@@ -1453,6 +1678,42 @@ struct has_reset_gt<check_at, return_at(args_at...)> {
  */
 template <typename at> constexpr bool has_reset() { return has_reset_gt<at, void()>::value; }
 
+template <typename, typename at> struct has_batch_gt {
+    static_assert(std::integral_constant<at, false>::value, "Second template parameter needs to be of function type.");
+};
+
+template <typename check_at, typename return_at, typename... args_at>
+struct has_batch_gt<check_at, return_at(args_at...)> {
+  private:
+    template <typename at>
+    static constexpr auto check(at*) ->
+        typename std::is_same<decltype(std::declval<at>().batch(std::declval<args_at>()...)), return_at>::type;
+    template <typename> static constexpr std::false_type check(...);
+
+    typedef decltype(check<check_at>(0)) type;
+
+  public:
+    static constexpr bool value = type::value;
+};
+
+template <typename, typename at> struct has_stored_gt {
+    static_assert(std::integral_constant<at, false>::value, "Second template parameter needs to be of function type.");
+};
+
+template <typename check_at, typename return_at, typename... args_at>
+struct has_stored_gt<check_at, return_at(args_at...)> {
+  private:
+    template <typename at>
+    static constexpr auto check(at*) ->
+        typename std::is_same<decltype(std::declval<at>().stored(std::declval<args_at>()...)), return_at>::type;
+    template <typename> static constexpr std::false_type check(...);
+
+    typedef decltype(check<check_at>(0)) type;
+
+  public:
+    static constexpr bool value = type::value;
+};
+
 struct serialization_result_t {
     error_t error;
 
@@ -1746,6 +2007,23 @@ struct precomputed_constants_t {
     std::size_t neighbors_base_bytes{};
 };
 
+/**
+ *  @brief  Renumbering of the slots of an index, kept in both directions.
+ *          Computed by `index_gt::locality_order`, and applied either in memory with `index_gt::reorder`,
+ *          or by the storage, when saving the nodes.
+ */
+template <typename slot_at> struct slot_permutation_gt {
+    /// @brief  The old slot of every new one.
+    buffer_gt<slot_at> order;
+    /// @brief  The new slot of every old one.
+    buffer_gt<slot_at> labels;
+
+    slot_permutation_gt() = default;
+    explicit slot_permutation_gt(std::size_t count) noexcept : order(count), labels(count) {}
+    explicit operator bool() const noexcept { return order && labels; }
+    std::size_t size() const noexcept { return order.size(); }
+};
+
 /**
  *  @brief  A slice of the node's tape, containing a the list of neighbors
  *          for a node in a single graph level. It's pre-allocated to fit
@@ -1765,6 +2043,7 @@ template <typename slot_at> class neighbors_ref_at {
 
   public:
     neighbors_ref_at(byte_t* tape) noexcept : tape_(tape) {}
+    byte_t* tape() const noexcept { return tape_; }
     compressed_slot_t* misaligned_tape() noexcept { return reinterpret_cast<compressed_slot_t*>(tape_ + shift()); }
     misaligned_ptr_gt<compressed_slot_t> begin() noexcept { return tape_ + shift(); }
     misaligned_ptr_gt<compressed_slot_t> end() noexcept { return begin() + size(); }
@@ -1784,6 +2063,11 @@ template <typename slot_at> class neighbors_ref_at {
         misaligned_store<compressed_slot_t>(tape_ + shift(n), slot);
         misaligned_store<neighbors_count_t>(tape_, n + 1);
     }
+    /// Replaces every neighbor with its new slot, looked up in @p labels.
+    void relabel(compressed_slot_t const* labels) noexcept {
+        for (std::size_t i = 0, n = size(); i != n; ++i)
+            misaligned_store<compressed_slot_t>(tape_ + shift(i), labels[static_cast<std::size_t>((*this)[i])]);
+    }
 };
 // todo:: this is public, but then we make assumptions which are not communicated via this interface
 // clean these up later
@@ -1860,12 +2144,249 @@ template <typename key_at, typename slot_at> class node_at {
     inline neighbors_ref_t neighbors_(const precomputed_constants_t& pre, level_t level) const noexcept {
         return level ? neighbors_non_base_(pre, level) : neighbors_base_();
     }
+
+    /// Renumbers the neighbors on every level of the node, after the slots were permuted.
+    void relabel(const precomputed_constants_t& pre, slot_t const* labels) const noexcept {
+        for (level_t level = 0; level <= this->level(); ++level)
+            neighbors_(pre, level).relabel(labels);
+    }
 };
 
 static_assert(std::is_trivially_copy_constructible<node_at<default_key_t, default_slot_t>>::value,
               "Nodes must be light!");
 static_assert(std::is_trivially_destructible<node_at<default_key_t, default_slot_t>>::value, "Nodes must be light!");
 
+/**
+ *  @brief  Compact in-memory mirror of the upper levels of a graph: the neighbors lists of every node above
+ *          the base level, together with its stored vector, in contiguous cache-line-aligned entries.
+ *
+ *  Only a small fraction of the nodes rises above the base level, but every search descends through them,
+ *  so with an external or a memory-mapped storage the greedy descent alone fetches pages all over it.
+ *  Entries are found by slot in an open-addressing table, that is sized in `reserve`, filled without locks,
+ *  and only emptied all at once. Nodes, that don't fit into it, are simply left in the storage.
+ *  Entries are rewritten by the holders of the node locks, and their lists are read like `neighbors_snapshot_`.
+ */
+template <typename slot_at, typename allocator_at = std::allocator<byte_t>> class upper_levels_gt {
+  public:
+    using compressed_slot_t = slot_at;
+    using neighbors_ref_t = neighbors_ref_at<compressed_slot_t>;
+    using allocator_t = allocator_at;
+
+    /// @brief  Alignment of the entries and the vectors within them, matching `vector_alignment_k` of the plugins.
+    static constexpr std::size_t alignment_k = 64;
+
+  private:
+    /// @brief  Entries are bump-allocated from a list of chunks, released only by `clear`.
+    struct chunk_t {
+        chunk_t* previous;
+        std::size_t bytes;
+    };
+    static constexpr std::size_t chunk_bytes_k = 1024 * 1024;
+
+    struct bucket_t {
+        std::atomic<byte_t*> entry;
+    };
+
+    buffer_gt<bucket_t> table_{};
+    std::atomic<std::size_t> count_{};
+    std::size_t neighbors_bytes_{};
+    std::size_t vector_bytes_{};
+    chunk_t* chunk_{};
+    std::size_t chunk_used_{};
+    std::mutex chunks_mutex_{};
+
+    // Every entry is laid out as `[ vector | slot | level | has vector | neighbors of levels 1...level ]`
+    static constexpr std::size_t head_bytes() { return sizeof(compressed_slot_t) + sizeof(level_t) + 1; }
+    std::size_t head_offset() const noexcept { return vector_bytes_; }
+    std::size_t entry_bytes(level_t level) const noexcept {
+        return divide_round_up<alignment_k>(head_offset() + head_bytes() + neighbors_bytes_ * level) * alignment_k;
+    }
+    std::size_t bucket(compressed_slot_t slot) const noexcept {
+        std::uint64_t hash = static_cast<std::uint64_t>(slot) * 0x9E3779B97F4A7C15ull;
+        return static_cast<std::size_t>(hash >> 32) & (table_.size() - 1);
+    }
+    compressed_slot_t entry_slot(byte_t const* entry) const noexcept {
+        return misaligned_load<compressed_slot_t>(const_cast<byte_t*>(entry) + head_offset());
+    }
+
+    byte_t* allocate(std::size_t bytes) noexcept {
+        std::unique_lock<std::mutex> lock(chunks_mutex_);
+        std::size_t const header_bytes = divide_round_up<alignment_k>(sizeof(chunk_t)) * alignment_k;
+        if (!chunk_ || chunk_used_ + bytes > chunk_->bytes) {
+            std::size_t new_bytes = (std::max)(chunk_bytes_k, header_bytes + bytes + alignment_k);
+            byte_t* memory = allocator_t{}.allocate(new_bytes);
+            if (!memory)
+                return nullptr;
+            chunk_t* chunk = reinterpret_cast<chunk_t*>(memory);
+            chunk->previous = chunk_, chunk->bytes = new_bytes;
+            std::uintptr_t address = reinterpret_cast<std::uintptr_t>(memory) + header_bytes;
+            chunk_ = chunk;
+            chunk_used_ = header_bytes + (alignment_k - address % alignment_k) % alignment_k;
+        }
+        byte_t* entry = reinterpret_cast<byte_t*>(chunk_) + chunk_used_;
+        chunk_used_ += bytes;
+        return entry;
+    }
+
+    void release_chunks() noexcept {
+        while (chunk_) {
+            chunk_t* previous = chunk_->previous;
+            allocator_t{}.deallocate(reinterpret_cast<byte_t*>(chunk_), chunk_->bytes);
+            chunk_ = previous;
+        }
+        chunk_used_ = 0;
+    }
+
+  public:
+    upper_levels_gt() noexcept = default;
+    upper_levels_gt(upper_levels_gt const&) = delete;
+    upper_levels_gt& operator=(upper_levels_gt const&) = delete;
+    ~upper_levels_gt() noexcept { reset(); }
+
+    explicit operator bool() const noexcept { return table_.size(); }
+    std::size_t size() const noexcept { return count_.load(std::memory_order_relaxed); }
+    /// @brief  Maximum number of entries, keeping the table at most half-full.
+    std::size_t capacity() const noexcept { return table_.size() / 2; }
+    std::size_t vector_bytes() const noexcept { return vector_bytes_; }
+
+    /**
+     *  @brief  Sizes the table for the upper levels of a graph with @p members, keeping the entries,
+     *          unless the sizes of the lists or of the vectors have changed. Not thread-safe.
+     */
+    bool reserve(std::size_t members, std::size_t connectivity, std::size_t neighbors_bytes,
+                 std::size_t vector_bytes) noexcept {
+        if (neighbors_bytes != neighbors_bytes_ || vector_bytes != vector_bytes_)
+            clear(), neighbors_bytes_ = neighbors_bytes, vector_bytes_ = vector_bytes;
+
+        // Every node rises above the base level with a probability of `1 / connectivity`
+        std::size_t expected = members / (std::max<std::size_t>)(connectivity, 1u) * 2u + 64u;
+        std::size_t table_size = ceil2(expected * 2u);
+        if (table_size <= table_.size())
+            return true;
+
+        buffer_gt<bucket_t> new_table(table_size);
+        if (!new_table)
+            return false;
+        for (bucket_t& new_bucket : new_table)
+            new_bucket.entry.store(nullptr, std::memory_order_relaxed);
+        std::swap(table_, new_table);
+        for (bucket_t& old_bucket : new_table) {
+            byte_t* entry = old_bucket.entry.load(std::memory_order_relaxed);
+            if (!entry)
+                continue;
+            std::size_t idx = bucket(entry_slot(entry));
+            while (table_[idx].entry.load(std::memory_order_relaxed))
+                idx = (idx + 1) & (table_.size() - 1);
+            table_[idx].entry.store(entry, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    /// @brief  Drops all the entries, keeping the table.
+    void clear() noexcept {
+        for (bucket_t& old_bucket : table_)
+            old_bucket.entry.store(nullptr, std::memory_order_relaxed);
+        count_ = 0;
+        release_chunks();
+    }
+
+    /// @brief  Drops all the entries and the table.
+    void reset() noexcept {
+        clear();
+        table_ = {};
+    }
+
+    void swap(upper_levels_gt& other) noexcept {
+        std::swap(table_, other.table_);
+        std::size_t count = count_;
+        count_ = other.count_.load();
+        other.count_ = count;
+        std::swap(neighbors_bytes_, other.neighbors_bytes_);
+        std::swap(vector_bytes_, other.vector_bytes_);
+        std::swap(chunk_, other.chunk_);
+        std::swap(chunk_used_, other.chunk_used_);
+    }
+
+    /// @brief  Finds the entry of @p slot, or returns `nullptr`, if the node isn't mirrored.
+    byte_t const* find(compressed_slot_t slot) const noexcept {
+        if (!table_.size())
+            return nullptr;
+        for (std::size_t idx = bucket(slot);; idx = (idx + 1) & (table_.size() - 1)) {
+            byte_t const* entry = table_[idx].entry.load(std::memory_order_acquire);
+            if (!entry || entry_slot(entry) == slot)
+                return entry;
+        }
+    }
+
+    level_t level(byte_t const* entry) const noexcept {
+        return misaligned_load<level_t>(const_cast<byte_t*>(entry) + head_offset() + sizeof(compressed_slot_t));
+    }
+    /// @brief  The list of neighbors on the given upper @p level, that must not exceed the `level` of the entry.
+    neighbors_ref_t neighbors(byte_t const* entry, level_t level) const noexcept {
+        byte_t* lists = const_cast<byte_t*>(entry) + head_offset() + head_bytes();
+        return {lists + neighbors_bytes_ * (level - 1)};
+    }
+    /// @brief  The stored vector, or `nullptr`, if the node had none when it was mirrored.
+    byte_t const* vector(byte_t const* entry) const noexcept {
+        return entry[head_offset() + head_bytes() - 1] ? entry : nullptr;
+    }
+
+    /**
+     *  @brief  Mirrors the node in @p slot, copying the neighbors lists of all its upper levels,
+     *          stored contiguously from @p lists, and its stored @p vector, if it has one.
+     *          The caller must hold the lock of the node, or be the only writer.
+     *  @return `false` if the node has no upper levels, or doesn't fit.
+     */
+    bool store(compressed_slot_t slot, level_t level, byte_t const* lists, byte_t const* vector) noexcept {
+        if (!table_.size() || level < 1)
+            return false;
+
+        // The entry is rewritten in place, unless the node has changed its level
+        std::size_t idx = bucket(slot);
+        byte_t* entry = table_[idx].entry.load(std::memory_order_acquire);
+        for (; entry && entry_slot(entry) != slot; entry = table_[idx].entry.load(std::memory_order_acquire))
+            idx = (idx + 1) & (table_.size() - 1);
+        bool const exists = entry;
+        if (exists && this->level(entry) == level) {
+            if (vector)
+                std::memcpy(entry, vector, vector_bytes_);
+            entry[head_offset() + head_bytes() - 1] = vector != nullptr;
+            std::memcpy(entry + head_offset() + head_bytes(), lists, neighbors_bytes_ * level);
+            return true;
+        }
+        if (!exists && count_.fetch_add(1, std::memory_order_relaxed) >= capacity()) {
+            count_.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        byte_t* new_entry = allocate(entry_bytes(level));
+        if (!new_entry) {
+            if (!exists)
+                count_.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (vector)
+            std::memcpy(new_entry, vector, vector_bytes_);
+        misaligned_store<compressed_slot_t>(new_entry + head_offset(), slot);
+        misaligned_store<level_t>(new_entry + head_offset() + sizeof(compressed_slot_t), level);
+        new_entry[head_offset() + head_bytes() - 1] = vector != nullptr;
+        std::memcpy(new_entry + head_offset() + head_bytes(), lists, neighbors_bytes_ * level);
+
+        // Other writers may have claimed the empty buckets on the way, while we were filling the entry
+        if (exists) {
+            table_[idx].entry.store(new_entry, std::memory_order_release);
+            return true;
+        }
+        while (true) {
+            byte_t* expected = nullptr;
+            if (table_[idx].entry.compare_exchange_strong(expected, new_entry, std::memory_order_release,
+                                                    std::memory_order_relaxed))
+                return true;
+            idx = (idx + 1) & (table_.size() - 1);
+        }
+    }
+};
+
 /**
  *  @brief  Approximate Nearest Neighbors Search @b index-structure using the
  *          Hierarchical Navigable Small World @b (HNSW) graphs algorithm.
@@ -1958,7 +2479,13 @@ template <typename storage_at,                                    //
           char visits_container_type_ak = 'G'>                    //
 class index_gt {
     static_assert(visits_container_type_ak == 'B' || visits_container_type_ak == 'U' ||
-                  visits_container_type_ak == 'G');
+                  visits_container_type_ak == 'G' || visits_container_type_ak == 'E');
+
+    /// @brief Whether the visits container is indexed by slots, and is sized for all of them in `reserve`.
+    static constexpr bool visits_by_slot_k = visits_container_type_ak == 'B' || visits_container_type_ak == 'E';
+
+    /// @brief Number of entries, the predicate of a filtered search is tested on to estimate its selectivity.
+    static constexpr std::size_t selectivity_samples_k = 256;
 
   public:
     using storage_t = storage_at;
@@ -1987,7 +2514,7 @@ class index_gt {
         member_iterator_gt(index_t* index, std::uint64_t slot) noexcept : index_(index), slot_(slot) {}
 
         index_t* index_{};
-        compressed_slot_t slot_{};
+        std::uint64_t slot_{};
 
       public:
         using iterator_category = std::random_access_iterator_tag;
@@ -2049,13 +2576,15 @@ class index_gt {
     using visits_growing_hash_set_t =
         growing_hash_set_gt<compressed_slot_t, compressed_slot_hasher, dynamic_allocator_t>;
     using visits_bitset_t = bitset_gt<>;
+    using visits_epoch_set_t = epoch_set_gt<>;
     // clang-format off
     // todo:: q:: what type can I put in place of int below to cause nicer error messages when wrong type arg is passed?
     using visits_set_t =
         std::conditional_t<visits_container_type_ak == 'B', visits_bitset_t,
         std::conditional_t<visits_container_type_ak == 'U', visits_unordered_set_t,
         std::conditional_t<visits_container_type_ak == 'G', visits_growing_hash_set_t,
-        int>>>;
+        std::conditional_t<visits_container_type_ak == 'E', visits_epoch_set_t,
+        int>>>>;
     // clang-format on
 
     /// @brief A space-efficient internal data-structure used in graph traversal queues.
@@ -2079,7 +2608,13 @@ class index_gt {
         top_candidates_t top_candidates{};
         next_candidates_t next_candidates{};
         visits_set_t visits{};
-        visits_set_t consumed{};
+        /// @brief Growable max-heap of the matches of a range search, that can outnumber the `top_candidates`.
+        next_candidates_t range_candidates{};
+        /// @brief Copy of a neighbors list, read from a node without locking it.
+        buffer_gt<byte_t> neighbors_snapshot{};
+        /// @brief Unvisited neighbors of a candidate, gathered to be scored at once, and their distances.
+        buffer_gt<compressed_slot_t> successors{};
+        buffer_gt<distance_t> successors_distances{};
         std::default_random_engine level_generator{};
         std::size_t iteration_cycles{};
         std::size_t computed_distances_count{};
@@ -2103,6 +2638,45 @@ class index_gt {
             computed_distances_count++;
             return metric(first, second);
         }
+
+        /// @brief  Compares to a stored vector, copied out of the storage, like the ones in `upper_levels_gt`.
+        template <typename value_at, typename metric_at> //
+        inline distance_t measure_stored(value_at const& first, byte_t const* second, metric_at&& metric) noexcept {
+            computed_distances_count++;
+            return metric.stored(first, second);
+        }
+
+        /**
+         *  @brief  Compares one entry to many queries, picked from @p queries by @p query_ids.
+         *          Uses the `batch` method of the metric, if it has one, to fetch the entry only once.
+         */
+        template <typename queries_at, typename metric_at, typename entry_at> //
+        inline void measure_batch(queries_at const& queries, std::size_t const* query_ids, std::size_t count,
+                                  entry_at const& entry, metric_at&& metric, distance_t* distances) noexcept {
+            using metric_t = typename std::decay<metric_at>::type;
+            using batch_signature_t =
+                void(entry_at const&, queries_at const&, std::size_t const*, std::size_t, distance_t*);
+            using has_batch_t = std::integral_constant<bool, has_batch_gt<metric_t, batch_signature_t>::value>;
+
+            computed_distances_count += count;
+            measure_batch_(queries, query_ids, count, entry, metric, distances, has_batch_t{});
+        }
+
+      private:
+        template <typename queries_at, typename metric_at, typename entry_at> //
+        inline void measure_batch_(queries_at const& queries, std::size_t const* query_ids, std::size_t count,
+                                   entry_at const& entry, metric_at&& metric, distance_t* distances,
+                                   std::true_type) noexcept {
+            metric.batch(entry, queries, query_ids, count, distances);
+        }
+
+        template <typename queries_at, typename metric_at, typename entry_at> //
+        inline void measure_batch_(queries_at const& queries, std::size_t const* query_ids, std::size_t count,
+                                   entry_at const& entry, metric_at&& metric, distance_t* distances,
+                                   std::false_type) noexcept {
+            for (std::size_t i = 0; i != count; ++i)
+                distances[i] = metric(queries[query_ids[i]], entry);
+        }
     };
 
     storage_t* storage_{};
@@ -2129,6 +2703,11 @@ class index_gt {
     /// @brief  The slot in which the only node of the top-level graph is stored.
     compressed_slot_t entry_slot_{};
 
+    using upper_levels_t = upper_levels_gt<compressed_slot_t, dynamic_allocator_t>;
+
+    /// @brief  Optional mirror of the nodes above the base level, see `index_config_t::cache_upper_levels`.
+    upper_levels_t upper_levels_{};
+
     using contexts_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<context_t>;
 
     /// @brief  Array of thread-specific buffers for temporary data.
@@ -2235,6 +2814,7 @@ class index_gt {
         nodes_count_ = 0;
         max_level_ = -1;
         entry_slot_ = 0u;
+        upper_levels_.clear();
     }
 
     /**
@@ -2250,6 +2830,7 @@ class index_gt {
         if (storage_)
             storage_->reset();
         contexts_ = {};
+        upper_levels_.reset();
         limits_ = index_limits_t{0, 0};
         nodes_capacity_ = 0;
     }
@@ -2271,6 +2852,7 @@ class index_gt {
         std::swap(max_level_, other.max_level_);
         std::swap(entry_slot_, other.entry_slot_);
         std::swap(contexts_, other.contexts_);
+        upper_levels_.swap(other.upper_levels_);
 
         // Non-atomic parts.
         std::size_t capacity_copy = nodes_capacity_;
@@ -2297,10 +2879,31 @@ class index_gt {
         if (!new_contexts || !storage_reserved)
             return false;
 
+        std::size_t const snapshot_bytes = (std::max)(pre_.neighbors_bytes, pre_.neighbors_base_bytes);
+        std::size_t const successors_count = (std::max)(config_.connectivity, config_.connectivity_base);
+        for (std::size_t i = 0; i != new_contexts.size(); ++i) {
+            new_contexts[i].neighbors_snapshot = buffer_gt<byte_t>(snapshot_bytes);
+            new_contexts[i].successors = buffer_gt<compressed_slot_t>(successors_count);
+            new_contexts[i].successors_distances = buffer_gt<distance_t>(successors_count);
+            if (!new_contexts[i].neighbors_snapshot || !new_contexts[i].successors ||
+                !new_contexts[i].successors_distances)
+                return false;
+        }
+
+        // The mirror drops its entries, if the layout of the nodes has changed, and is refilled from the storage
+        if (config_.cache_upper_levels) {
+            bool const mirrored = upper_levels_.size();
+            if (!upper_levels_.reserve(limits.members, config_.connectivity, pre_.neighbors_bytes,
+                                       storage_->stored_vector_size_bytes()))
+                return false;
+            if (mirrored && !upper_levels_.size())
+                mirror_upper_levels_();
+        }
+
         limits_ = limits;
         nodes_capacity_ = limits.members;
         contexts_ = std::move(new_contexts);
-        if (visits_container_type_ak == 'B') {
+        if (visits_by_slot_k) {
             for (std::size_t i = 0; i < limits.threads(); i++) {
                 contexts_[i].visits.reserve(nodes_capacity_);
             }
@@ -2359,11 +2962,16 @@ class index_gt {
 
     class search_result_t {
         storage_t const* storage_{};
-        top_candidates_t const* top_{};
+        top_candidates_t* top_{};
+        next_candidates_t* range_{};
 
         friend class index_gt;
         inline search_result_t(index_gt const& index, top_candidates_t& top) noexcept
             : storage_(index.storage_), top_(&top) {}
+        inline search_result_t(index_gt const& index, next_candidates_t& range) noexcept
+            : storage_(index.storage_), range_(&range) {}
+
+        inline candidate_t* ordered_() const noexcept { return top_ ? top_->data() : range_->data(); }
 
       public:
         /** @brief  Number of search results found. */
@@ -2397,7 +3005,7 @@ class index_gt {
             return false;
         }
         inline match_t at(std::size_t i) const noexcept {
-            candidate_t const* top_ordered = top_->data();
+            candidate_t const* top_ordered = ordered_();
             candidate_t candidate = top_ordered[i];
             node_t node = storage_->get_node_at(candidate.slot);
             return {member_cref_t{node.ckey(), candidate.slot}, candidate.distance};
@@ -2438,6 +3046,74 @@ class index_gt {
             }
             return count;
         }
+
+        /**
+         *  @brief  Recomputes the distances of the found members with a different, usually more precise, metric,
+         *          re-sorts them and keeps only the ::wanted closest. Useful to refine results of a search over
+         *          quantized vectors, that was asked for more than ::wanted results.
+         *
+         *  @param[in] metric Callable object returning the new `distance_t` for a `member_cref_t`.
+         *  @return The number of results left.
+         */
+        template <typename metric_at> std::size_t rerank(metric_at&& metric, std::size_t wanted) noexcept {
+            candidate_t* top_ordered = ordered_();
+            for (std::size_t i = 0; i != count; ++i) {
+                node_t node = storage_->get_node_at(top_ordered[i].slot);
+                top_ordered[i].distance = metric(member_cref_t{node.ckey(), top_ordered[i].slot});
+            }
+            std::sort(top_ordered, top_ordered + count);
+            count = (std::min)(count, wanted);
+            if (top_)
+                top_->shrink(count);
+            else
+                range_->shrink(count);
+            return count;
+        }
+    };
+
+    /**
+     *  @brief  State of a resumable search, that yields the matches batch by batch, closest first.
+     *          Unlike the thread contexts, it owns its candidate queues and the visited set, so it can
+     *          outlive the `search_next` calls and move between threads.
+     */
+    class search_cursor_t {
+        /// @brief Up to `expansion` closest of the discovered matches, that weren't returned yet.
+        top_candidates_t top_{};
+        /// @brief The rest of the discovered matches, that weren't returned yet, farther than all of the `top_`.
+        next_candidates_t rest_{};
+        /// @brief Discovered entries, that weren't expanded yet.
+        next_candidates_t next_{};
+        /// @brief Matches returned by the last `search_next`.
+        top_candidates_t batch_{};
+        visits_set_t visits_{};
+        bool started_{};
+
+        friend class index_gt;
+
+      public:
+        search_cursor_t() noexcept {}
+        search_cursor_t(search_cursor_t&&) = default;
+        search_cursor_t& operator=(search_cursor_t&&) = default;
+
+        /// @brief Forgets the traversal, so that the next `search_next` starts a new search.
+        void reset() noexcept { started_ = false; }
+
+        /// @brief Whether all the matches, reachable in the graph, were returned.
+        bool exhausted() const noexcept { return started_ && top_.empty() && next_.empty(); }
+    };
+
+    struct search_batch_result_t {
+        error_t error{};
+        /** @brief  Number of graph nodes traversed, across all queries. */
+        std::size_t visited_members{};
+        /** @brief  Number of times the distances were computed, across all queries. */
+        std::size_t computed_distances{};
+
+        explicit operator bool() const noexcept { return !error; }
+        search_batch_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
     };
 
     struct cluster_result_t {
@@ -2534,6 +3210,7 @@ class index_gt {
         result.slot = slot;
         callback(at(slot));
         node_lock_t new_lock = storage_->node_lock(slot);
+        mirror_upper_node_(slot);
 
         // Do nothing for the first element
         if (!old_count) {
@@ -2635,30 +3312,324 @@ class index_gt {
         if (!next.reserve(config.expansion))
             return result.failed("Out of memory!");
 
-        node_lock_t new_lock = storage_->node_lock(old_slot);
+        // Revising the old neighbors takes the lists of two nodes at once
+        if (!top.reserve(connectivity_max * 2u) || !context.visits.reserve(connectivity_max * 2u + 1u))
+            return result.failed("Out of memory!");
+
+        // The node is locked only while its own lists are read or rewritten, and never while locking
+        // its neighbors, as a concurrent update of one of them may be waiting for this node in turn.
+        // The neighbors will measure their distances to the new content,
+        // so it must be in place before any links are revised
         node_t node = storage_->get_node_at_mut(old_slot);
+        level_t node_level;
+        level_t fallback_level = -1;
+        compressed_slot_t fallback_slot = static_cast<compressed_slot_t>(old_slot);
+        {
+            node_lock_t lock = storage_->node_lock(old_slot);
+            node_level = node.level();
+            node.key(key);
+            result.new_size = size();
+            result.slot = old_slot;
+            callback(at(old_slot));
+
+            // Updating the entry point, the search has to start from one of its old neighbors instead
+            for (level_t level = node_level; level >= 0 && fallback_level < 0; --level) {
+                neighbors_ref_t old_neighbors = node.neighbors_(pre_, level);
+                if (old_neighbors.size())
+                    fallback_slot = old_neighbors[0], fallback_level = level;
+            }
+        }
 
-        level_t node_level = node.level();
-        span_bytes_t node_bytes = node.node_bytes(pre_);
-        std::memset(node_bytes.data(), 0, node_bytes.size());
-        node.level(node_level);
+        std::unique_lock<std::mutex> new_level_lock(global_mutex_);
+        level_t max_level_copy = max_level_;            // Copy under lock
+        compressed_slot_t entry_idx_copy = entry_slot_; // Copy under lock
+        if (node_level <= max_level_copy)
+            new_level_lock.unlock();
+        bool const is_entry = entry_idx_copy == old_slot;
+        if (is_entry)
+            entry_idx_copy = fallback_slot, max_level_copy = fallback_level;
 
         // Pull stats
         result.computed_distances = context.computed_distances_count;
         result.visited_members = context.iteration_cycles;
 
-        connect_node_across_levels_(                       //
-            value, metric, prefetch,                       //
-            old_slot, entry_slot_, max_level_, node_level, //
-            config, context);
-        node.key(key);
+        // The reverse links from the old neighbors may no longer be worth keeping
+        for (level_t level = 0; level <= node_level; ++level) {
+            neighbors_ref_t old_neighbors{nullptr};
+            {
+                node_lock_t lock = storage_->node_lock(old_slot);
+                old_neighbors = neighbors_copy_(node, level, context);
+            }
+            relink_moved_node_(metric, old_slot, old_neighbors, level, context);
+        }
+
+        {
+            node_lock_t lock = storage_->node_lock(old_slot);
+            span_bytes_t node_bytes = node.node_bytes(pre_);
+            std::memset(node_bytes.data(), 0, node_bytes.size());
+            node.level(node_level);
+            node.key(key);
+            mirror_upper_node_(static_cast<compressed_slot_t>(old_slot));
+        }
+
+        // Without any old neighbors there is nothing left to connect to
+        if (max_level_copy < 0) {
+            result.computed_distances = context.computed_distances_count - result.computed_distances;
+            result.visited_members = context.iteration_cycles - result.visited_members;
+            return result;
+        }
+
+        // Same as `connect_node_across_levels_`, but with the node locked only to link it to its neighbors
+        compressed_slot_t closest_slot = search_for_one_( //
+            value, metric, prefetch,                      //
+            entry_idx_copy, max_level_copy, node_level, context);
+        for (level_t level = (std::min)(node_level, max_level_copy); level >= 0; --level) {
+            search_to_insert_(value, metric, prefetch, closest_slot, old_slot, level, config.expansion, context);
+            neighbors_ref_t new_neighbors{nullptr};
+            {
+                // Other entries may have linked to this one since it was cleared
+                node_lock_t lock = storage_->node_lock(old_slot);
+                node.neighbors_(pre_, level).clear();
+                closest_slot = connect_new_node_(metric, old_slot, level, context);
+                new_neighbors = neighbors_copy_(node, level, context);
+            }
+            reconnect_neighbor_nodes_(metric, old_slot, new_neighbors, value, level, context);
+        }
+        {
+            node_lock_t lock = storage_->node_lock(old_slot);
+            mirror_upper_node_(static_cast<compressed_slot_t>(old_slot));
+        }
 
         // Normalize stats
         result.computed_distances = context.computed_distances_count - result.computed_distances;
         result.visited_members = context.iteration_cycles - result.visited_members;
-        result.slot = old_slot;
 
-        callback(at(old_slot));
+        // Updating the entry point if needed
+        if (!is_entry && node_level > max_level_copy) {
+            entry_slot_ = old_slot;
+            max_level_ = node_level;
+        }
+        return result;
+    }
+
+    struct repair_result_t {
+        error_t error{};
+        std::size_t pruned_edges{};
+        std::size_t computed_distances{};
+
+        explicit operator bool() const noexcept { return !error; }
+        repair_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+    /**
+     *  @brief  Unlinks an entry from the @b disallowed ones, like the removed entries. Thread-safe.
+     *
+     *  Every level, that links to a disallowed neighbor, is rebuilt from the union of the remaining
+     *  neighbors and the neighbors of the disallowed ones, pruned with the same heuristic as on insertion,
+     *  so that the graph stays navigable around the removed region, like in FreshDiskANN.
+     *  The lists of the disallowed entries are left intact for the searches that still reach them.
+     *  Must not run concurrently with the reuse of the disallowed slots by `update`.
+     *
+     *  @param[in] iterator Iterator pointing to the entry to repair.
+     *  @param[in] metric Callable object measuring distance between present objects.
+     *  @param[in] disallow Predicate for `member_cref_t`, returning `true` for the entries to unlink.
+     *  @param[in] config Configuration options for this specific operation.
+     */
+    template <typename metric_at, typename disallow_at>
+    repair_result_t repair(                                                      //
+        member_iterator_t iterator, metric_at&& metric, disallow_at&& disallow, //
+        index_update_config_t config = {}) usearch_noexcept_m {
+
+        repair_result_t result;
+        compressed_slot_t const slot = static_cast<compressed_slot_t>(iterator.slot_);
+        if (disallow(at(slot)))
+            return result;
+
+        context_t& context = contexts_[config.thread];
+        top_candidates_t& top = context.top_candidates;
+        visits_set_t& visits = context.visits;
+        result.computed_distances = context.computed_distances_count;
+
+        node_lock_t lock = storage_->node_lock(slot);
+        node_t node = storage_->get_node_at_mut(slot);
+        for (level_t level = 0; level <= node.level(); ++level) {
+            neighbors_ref_t neighbors = node.neighbors_(pre_, level);
+            std::size_t disallowed_count = 0;
+            for (compressed_slot_t neighbor_slot : neighbors)
+                disallowed_count += disallow(at(neighbor_slot));
+            if (!disallowed_count)
+                continue;
+
+            // Gather the candidates, skipping the duplicates
+            std::size_t const connectivity_max = level ? config_.connectivity : config_.connectivity_base;
+            top.clear();
+            visits.clear();
+            if (!visits.reserve(neighbors.size() + 1u) || !top.reserve(neighbors.size()))
+                return result.failed("Out of memory!");
+            visits.set(slot);
+            for (compressed_slot_t neighbor_slot : neighbors)
+                if (!disallow(at(neighbor_slot)) && !visits.set(neighbor_slot))
+                    top.insert_reserved(
+                        {context.measure(citerator_at(slot), citerator_at(neighbor_slot), metric), neighbor_slot});
+
+            for (compressed_slot_t neighbor_slot : neighbors) {
+                if (!disallow(at(neighbor_slot)))
+                    continue;
+                neighbors_ref_t bridged = neighbors_snapshot_(neighbor_slot, level, context);
+                if (!visits_by_slot_k && !visits.reserve(visits.size() + bridged.size()))
+                    return result.failed("Out of memory!");
+                if (!top.reserve(top.size() + bridged.size()))
+                    return result.failed("Out of memory!");
+                for (compressed_slot_t bridged_slot : bridged)
+                    if (!disallow(at(bridged_slot)) && !visits.set(bridged_slot))
+                        top.insert_reserved(
+                            {context.measure(citerator_at(slot), citerator_at(bridged_slot), metric), bridged_slot});
+            }
+
+            // Export the results:
+            neighbors.clear();
+            candidates_view_t top_view = refine_(metric, connectivity_max, top, context);
+            for (std::size_t idx = 0; idx != top_view.size(); idx++)
+                neighbors.push_back(top_view[idx].slot);
+            result.pruned_edges += disallowed_count;
+        }
+        if (result.pruned_edges)
+            mirror_upper_node_(slot);
+
+        result.computed_distances = context.computed_distances_count - result.computed_distances;
+        return result;
+    }
+
+    /**
+     *  @brief  Moves the entry point away from a @b disallowed entry, to the highest of the remaining ones.
+     *          Must be called after `repair`-ing the other entries, and not concurrently with insertions.
+     *  @param[in] disallow Predicate for `member_cref_t`, returning `true` for the entries to avoid.
+     */
+    template <typename disallow_at> void repair_entry(disallow_at&& disallow) usearch_noexcept_m {
+        std::unique_lock<std::mutex> new_level_lock(global_mutex_);
+        if (!size() || !disallow(at(entry_slot_)))
+            return;
+
+        level_t best_level = -1;
+        for (std::size_t slot = 0; slot != size(); ++slot) {
+            level_t level = storage_->get_node_at(slot).level();
+            if (level > best_level && !disallow(at(slot)))
+                best_level = level, entry_slot_ = static_cast<compressed_slot_t>(slot);
+        }
+        if (best_level >= 0)
+            max_level_ = best_level;
+    }
+
+    using slot_permutation_t = slot_permutation_gt<compressed_slot_t>;
+
+    struct reorder_result_t {
+        error_t error{};
+        slot_permutation_t permutation{};
+
+        explicit operator bool() const noexcept { return !error; }
+        reorder_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+    /**
+     *  @brief  Computes a locality-preserving order of the slots, without changing the index.
+     *
+     *  Slots are assigned in the insertion order, so the neighbors of a node are scattered across
+     *  the whole storage, and every hop of a search is a cache miss, or a page fault in a viewed file.
+     *  This order is a breadth-first traversal of the base level from the entry point, continued from
+     *  the first unreached slot, if some are disconnected, so that neighbors end up in nearby slots.
+     *  Must not run concurrently with insertions.
+     *
+     *  @param[in] progress Callback reporting the traversed nodes.
+     */
+    template <typename progress_at = dummy_progress_t>
+    reorder_result_t locality_order(progress_at&& progress = progress_at{}) const noexcept {
+
+        reorder_result_t result;
+        std::size_t const count = size();
+        if (!count)
+            return result;
+
+        slot_permutation_t permutation(count);
+        if (!permutation)
+            return result.failed("Out of memory!");
+        compressed_slot_t const unreached = default_free_value<compressed_slot_t>();
+        std::fill(permutation.labels.begin(), permutation.labels.end(), unreached);
+
+        // The order itself serves as the queue of the traversal
+        std::size_t tail = 0;
+        std::size_t next_root = 0;
+        auto discover = [&](std::size_t slot) noexcept {
+            permutation.labels[slot] = static_cast<compressed_slot_t>(tail);
+            permutation.order[tail++] = static_cast<compressed_slot_t>(slot);
+        };
+        discover(static_cast<std::size_t>(entry_slot_));
+        for (std::size_t head = 0; head != count; ++head) {
+            if (head == tail) {
+                while (permutation.labels[next_root] != unreached)
+                    ++next_root;
+                discover(next_root);
+            }
+            node_t node = storage_->get_node_at(static_cast<std::size_t>(permutation.order[head]));
+            for (compressed_slot_t neighbor : node.neighbors_base_())
+                if (permutation.labels[static_cast<std::size_t>(neighbor)] == unreached)
+                    discover(static_cast<std::size_t>(neighbor));
+
+            if (!progress(head + 1, count))
+                return result.failed("Terminated by user");
+        }
+
+        result.permutation = std::move(permutation);
+        return result;
+    }
+
+    /**
+     *  @brief  Moves every node into its slot in the @p permutation, and renumbers all neighbor lists,
+     *          in parallel. Slots, previously returned to the user, are invalidated.
+     *          Must not run concurrently with any other operation.
+     *
+     *  @param[in] permutation Renumbering of all the slots, like the one from `locality_order`.
+     *  @param[in] executor Thread-pool to execute the job in parallel.
+     *  @param[in] progress Callback reporting the renumbered nodes, that can't interrupt the job.
+     */
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
+    reorder_result_t reorder(                                     //
+        slot_permutation_t const& permutation,                    //
+        executor_at&& executor = executor_at{},                   //
+        progress_at&& progress = progress_at{}) usearch_noexcept_m {
+
+        reorder_result_t result;
+        std::size_t const count = size();
+        if (permutation.size() != count)
+            return result.failed("Permutation doesn't match the index size");
+        if (!count)
+            return result;
+        if (is_immutable())
+            return result.failed("Can't reorder an immutable index");
+        if (!storage_->permute(permutation.order.data(), count))
+            return result.failed("The storage doesn't support reordering");
+
+        // Nodes are already in their new slots, so every one of them can be relabeled independently.
+        // Once they are moved, the job can't be interrupted, so the progress can't terminate it.
+        std::atomic<std::size_t> processed{0};
+        executor.dynamic(count, [&](std::size_t thread_idx, std::size_t slot) {
+            storage_->get_node_at_mut(slot).relabel(pre_, permutation.labels.data());
+
+            // It's more efficient in this case to report progress from a single thread
+            processed += 1;
+            if (thread_idx == 0)
+                progress(processed.load(), count);
+            return true;
+        });
+
+        entry_slot_ = permutation.labels[static_cast<std::size_t>(entry_slot_)];
+        mirror_upper_levels_();
+        progress(count, count);
         return result;
     }
 
@@ -2683,8 +3654,7 @@ class index_gt {
         metric_at&& metric,                        //
         index_search_config_t config = {},         //
         predicate_at&& predicate = predicate_at{}, //
-        prefetch_at&& prefetch = prefetch_at{},    //
-        bool continue_search = false               //
+        prefetch_at&& prefetch = prefetch_at{}     //
     ) const noexcept {
 
         context_t& context = contexts_[config.thread];
@@ -2700,27 +3670,244 @@ class index_gt {
         if (config.exact) {
             if (!top.reserve(wanted))
                 return result.failed("Out of memory!");
-            search_exact_(query, metric, predicate, wanted, context, continue_search);
+            search_exact_(query, metric, predicate, wanted, context);
         } else {
-            next_candidates_t& next = context.next_candidates;
-            std::size_t expansion = (std::max)(config.expansion, wanted);
-            if (!next.reserve(expansion))
+            compressed_slot_t closest_slot =
+                search_for_one_(query, metric, prefetch, entry_slot_, max_level_, 0, context);
+
+            // For bottom layer we need a more optimized procedure
+            if (!search_in_base_(query, wanted, metric, config, predicate, prefetch, closest_slot, context))
                 return result.failed("Out of memory!");
-            if (!top.reserve(expansion))
+        }
+
+        keep_closest_(top, wanted, config.radius);
+
+        // Normalize stats
+        result.computed_distances = context.computed_distances_count - result.computed_distances;
+        result.visited_members = context.iteration_cycles - result.visited_members;
+        result.count = top.size();
+        return result;
+    }
+
+    /**
+     *  @brief Searches for all the elements within the ::radius from the given ::query. Thread-safe.
+     *
+     *  Unlike `search`, the number of results isn't bounded by the expansion factor. The base-layer
+     *  beam keeps expanding, while any candidate on its frontier is within the ::radius, and the matches
+     *  are collected into a growable buffer. If more than ::limit are found, only the closest are kept.
+     *
+     *  @param[in] query Content that will be compared against other entries in the index.
+     *  @param[in] radius The upper bound for the distance to returned matches, inclusive.
+     *  @param[in] limit The upper bound for the number of results to return.
+     *  @param[in] config Configuration options for this specific operation, the `config.radius` is ignored.
+     *  @param[in] predicate Optional filtering predicate for `member_cref_t`.
+     *  @return Smart object referencing temporary memory. Valid until next `search()`, `add()`, or `cluster()`.
+     */
+    template <                                     //
+        typename value_at,                         //
+        typename metric_at,                        //
+        typename predicate_at = dummy_predicate_t, //
+        typename prefetch_at = dummy_prefetch_t    //
+        >
+    search_result_t search_range(                  //
+        value_at&& query,                          //
+        distance_t radius,                         //
+        std::size_t limit,                         //
+        metric_at&& metric,                        //
+        index_search_config_t config = {},         //
+        predicate_at&& predicate = predicate_at{}, //
+        prefetch_at&& prefetch = prefetch_at{}     //
+    ) const noexcept {
+
+        context_t& context = contexts_[config.thread];
+        next_candidates_t& found = context.range_candidates;
+        found.clear();
+        if (!nodes_count_ || !limit)
+            return search_result_t{*this, found};
+
+        std::size_t const computed_distances = context.computed_distances_count;
+        std::size_t const visited_members = context.iteration_cycles;
+
+        compressed_slot_t closest_slot = search_for_one_(query, metric, prefetch, entry_slot_, max_level_, 0, context);
+        if (!context.next_candidates.reserve(config.expansion) || !context.top_candidates.reserve(config.expansion))
+            return search_result_t{*this, found}.failed("Out of memory!");
+        if (!search_to_find_in_range_(query, metric, predicate, prefetch, closest_slot, config.expansion, radius,
+                                      limit, context))
+            return search_result_t{*this, found}.failed("Out of memory!");
+
+        found.sort_ascending();
+        search_result_t result{*this, found};
+        result.computed_distances = context.computed_distances_count - computed_distances;
+        result.visited_members = context.iteration_cycles - visited_members;
+        result.count = found.size();
+        return result;
+    }
+
+    /**
+     *  @brief Yields the next closest elements to the given ::query, continuing the search of the ::cursor.
+     *  Thread-safe, as long as different threads use different cursors.
+     *
+     *  The first call descends to the base layer, like `search`, and returns the same matches. The next ones
+     *  continue the base-layer traversal where it stopped, widening the beam of `config.expansion` entries past
+     *  the returned matches. Every batch is sorted, and the batches are ordered up to the approximation error.
+     *  The ::query, ::metric, ::predicate and `config.exact` must stay the same, until the cursor is `reset`.
+     *
+     *  @param[inout] cursor State of the search, that can move between threads in-between the calls.
+     *  @param[in] query Content that will be compared against other entries in the index.
+     *  @param[in] wanted The upper bound for the number of results to return in this batch.
+     *  @param[in] config Configuration options for this specific operation.
+     *  @param[in] predicate Optional filtering predicate for `member_cref_t`.
+     *  @return Smart object referencing the memory of the ::cursor. Valid until its next use.
+     */
+    template <                                     //
+        typename value_at,                         //
+        typename metric_at,                        //
+        typename predicate_at = dummy_predicate_t, //
+        typename prefetch_at = dummy_prefetch_t    //
+        >
+    search_result_t search_next(                   //
+        search_cursor_t& cursor,                   //
+        value_at&& query,                          //
+        std::size_t wanted,                        //
+        metric_at&& metric,                        //
+        index_search_config_t config = {},         //
+        predicate_at&& predicate = predicate_at{}, //
+        prefetch_at&& prefetch = prefetch_at{}     //
+    ) const noexcept {
+
+        context_t& context = contexts_[config.thread];
+        top_candidates_t& batch = cursor.batch_;
+        top_candidates_t& top = cursor.top_;
+        next_candidates_t& rest = cursor.rest_;
+        search_result_t result{*this, batch};
+        batch.clear();
+        if (!nodes_count_ || !wanted)
+            return result;
+
+        std::size_t const expansion = (std::max)(config.expansion, wanted);
+        if (!batch.reserve(wanted) || !top.reserve(expansion) || !cursor.next_.reserve(expansion))
+            return result.failed("Out of memory!");
+        if (!cursor.visits_.reserve(visits_by_slot_k ? nodes_capacity_.load() : config_.connectivity_base + 1u))
+            return result.failed("Out of memory!");
+
+        result.computed_distances = context.computed_distances_count;
+        result.visited_members = context.iteration_cycles;
+
+        if (!cursor.started_) {
+            top.clear();
+            rest.clear();
+            cursor.next_.clear();
+            cursor.visits_.clear();
+            cursor.started_ = true;
+
+            // Exact search scores everything upfront, leaving nothing to traverse
+            if (config.exact) {
+                for (std::size_t i = 0; i != size(); ++i) {
+                    distance_t distance = context.measure(query, citerator_at(i), metric);
+                    if (!collect_into_cursor_(cursor, static_cast<compressed_slot_t>(i), distance, expansion,
+                                              predicate))
+                        return result.failed("Out of memory!");
+                }
+            } else {
+                compressed_slot_t closest_slot =
+                    search_for_one_(query, metric, prefetch, entry_slot_, max_level_, 0, context);
+                distance_t closest_dist = context.measure(query, citerator_at(closest_slot), metric);
+                cursor.next_.insert_reserved({-closest_dist, closest_slot});
+                cursor.visits_.set(closest_slot);
+                if (!collect_into_cursor_(cursor, closest_slot, closest_dist, expansion, predicate))
+                    return result.failed("Out of memory!");
+            }
+        }
+
+        while (batch.size() != wanted) {
+            if (!search_to_resume_in_base_(cursor, query, metric, predicate, prefetch, expansion, context))
                 return result.failed("Out of memory!");
+            if (top.empty())
+                break;
+
+            // Move the closest matches into the batch, and replace them with the closest of the `rest`
+            std::size_t moved = (std::min)(wanted - batch.size(), top.size());
+            for (std::size_t i = 0; i != moved; ++i)
+                batch.insert_reserved(candidate_t{top.data()[i]});
+            std::memmove(top.data(), top.data() + moved, (top.size() - moved) * sizeof(candidate_t));
+            top.shrink(top.size() - moved);
+            while (top.size() != expansion && !rest.empty()) {
+                candidate_t closest = rest.pop();
+                top.insert_reserved({-closest.distance, closest.slot});
+            }
+        }
 
-            compressed_slot_t closest_slot;
-            if (!continue_search)
-                closest_slot = search_for_one_(query, metric, prefetch, entry_slot_, max_level_, 0, context);
+        // Normalize stats
+        result.computed_distances = context.computed_distances_count - result.computed_distances;
+        result.visited_members = context.iteration_cycles - result.visited_members;
+        result.count = batch.size();
+        return result;
+    }
 
-            // For bottom layer we need a more optimized procedure
-            if (!search_to_find_in_base_(query, metric, predicate, prefetch, closest_slot, expansion, context,
-                                         continue_search))
+    /**
+     *  @brief Searches for the closest elements to the given ::query, passing a selective ::predicate. Thread-safe.
+     *
+     *  Unlike `search`, which filters the matches of an ordinary traversal, it adapts to the selectivity of
+     *  the predicate, taken from the `config` or estimated by sampling. With few entries passing, it
+     *  brute-forces them. Otherwise it traverses only the allowed entries, looking through the rejected
+     *  neighbors to the allowed ones two hops away, like ACORN, so that a sparse allowed subgraph
+     *  stays connected. If the traversal runs out of allowed entries early, it also falls back to brute-force.
+     *
+     *  @param[in] query Content that will be compared against other entries in the index.
+     *  @param[in] wanted The upper bound for the number of results to return.
+     *  @param[in] predicate Filtering predicate for `member_cref_t`.
+     *  @param[in] config Configuration options for this specific operation.
+     *  @return Smart object referencing temporary memory. Valid until next `search()`, `add()`, or `cluster()`.
+     */
+    template <                                  //
+        typename value_at,                      //
+        typename metric_at,                     //
+        typename predicate_at,                  //
+        typename prefetch_at = dummy_prefetch_t //
+        >
+    search_result_t filtered_search(           //
+        value_at&& query,                      //
+        std::size_t wanted,                    //
+        metric_at&& metric,                    //
+        predicate_at&& predicate,              //
+        index_search_config_t config = {},     //
+        prefetch_at&& prefetch = prefetch_at{} //
+    ) const noexcept {
+
+        context_t& context = contexts_[config.thread];
+        top_candidates_t& top = context.top_candidates;
+        search_result_t result{*this, top};
+        if (!nodes_count_)
+            return result;
+
+        result.computed_distances = context.computed_distances_count;
+        result.visited_members = context.iteration_cycles;
+
+        // Brute-forcing scores every allowed entry, while the traversal has to go through the
+        // neighbors of about `expansion / selectivity` entries to collect enough allowed ones
+        std::size_t const expansion = (std::max)(config.expansion, wanted);
+        double const selectivity = config.selectivity > 0 ? config.selectivity : estimate_selectivity_(predicate);
+        double const scored_exactly = selectivity * size();
+        double const scored_traversing = expansion * config_.connectivity_base / selectivity;
+        bool exact = config.exact || scored_exactly <= scored_traversing;
+
+        if (!exact) {
+            compressed_slot_t closest_slot =
+                search_for_one_(query, metric, prefetch, entry_slot_, max_level_, 0, context);
+            if (!context.next_candidates.reserve(expansion) || !top.reserve(expansion))
+                return result.failed("Out of memory!");
+            if (!search_to_find_in_filtered_base_(query, metric, predicate, prefetch, closest_slot, expansion,
+                                                  context))
+                return result.failed("Out of memory!");
+            exact = top.size() < wanted;
+        }
+        if (exact) {
+            if (!top.reserve(wanted))
                 return result.failed("Out of memory!");
+            search_exact_(query, metric, predicate, wanted, context);
         }
 
-        top.sort_ascending();
-        top.shrink(wanted);
+        keep_closest_(top, wanted, config.radius);
 
         // Normalize stats
         result.computed_distances = context.computed_distances_count - result.computed_distances;
@@ -2729,6 +3916,85 @@ class index_gt {
         return result;
     }
 
+    /**
+     *  @brief Searches for the closest elements to every query in a batch. Thread-safe.
+     *
+     *  Upper levels of the graph are traversed for the whole batch together: queries standing at the same
+     *  node share the fetch of its neighbors list, and every neighbor is compared to all of those queries
+     *  in a row, with `context_t::measure_batch`. The base layer is then searched query by query, so the
+     *  results match those of `search()`.
+     *
+     *  @param[in] queries Random-access container of @p queries_count queries, like `std::vector`.
+     *  @param[in] wanted The upper bound for the number of results to return for every query.
+     *  @param[in] config Configuration options for this specific operation, shared by all queries.
+     *  @param[in] callback Receives the index of a query and its `search_result_t`, valid until it returns.
+     *  @param[in] predicate Optional filtering predicate for `member_cref_t`.
+     *  @return Aggregated statistics of the batch, and the error, if any.
+     */
+    template <                                     //
+        typename queries_at,                       //
+        typename metric_at,                        //
+        typename callback_at,                      //
+        typename predicate_at = dummy_predicate_t, //
+        typename prefetch_at = dummy_prefetch_t    //
+        >
+    search_batch_result_t search_batch(            //
+        queries_at&& queries,                      //
+        std::size_t queries_count,                 //
+        std::size_t wanted,                        //
+        metric_at&& metric,                        //
+        index_search_config_t config,              //
+        callback_at&& callback,                    //
+        predicate_at&& predicate = predicate_at{}, //
+        prefetch_at&& prefetch = prefetch_at{}     //
+    ) const noexcept {
+
+        search_batch_result_t batch_result;
+        context_t& context = contexts_[config.thread];
+        top_candidates_t& top = context.top_candidates;
+        std::size_t const computed_distances_before = context.computed_distances_count;
+        std::size_t const iteration_cycles_before = context.iteration_cycles;
+
+        // Exhaustive search doesn't traverse the graph, so there is nothing to share between queries
+        if (!nodes_count_ || config.exact) {
+            for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx) {
+                search_result_t result = search(queries[query_idx], wanted, metric, config, predicate, prefetch);
+                if (!result)
+                    return batch_result.failed(std::move(result.error));
+                callback(query_idx, result);
+            }
+        } else {
+            buffer_gt<compressed_slot_t> closest_slots(queries_count);
+            buffer_gt<distance_t> closest_distances(queries_count);
+            buffer_gt<distance_t> distances(queries_count);
+            buffer_gt<std::size_t> active_queries(queries_count);
+            if (!closest_slots || !closest_distances || !distances || !active_queries)
+                return batch_result.failed("Out of memory!");
+
+            search_for_many_(queries, queries_count, metric, prefetch, closest_slots.data(),
+                             closest_distances.data(), distances.data(), active_queries.data(), context);
+
+            for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx) {
+                search_result_t result{*this, top};
+                result.computed_distances = context.computed_distances_count;
+                result.visited_members = context.iteration_cycles;
+                if (!search_in_base_(queries[query_idx], wanted, metric, config, predicate, prefetch,
+                                     closest_slots[query_idx], context))
+                    return batch_result.failed("Out of memory!");
+
+                keep_closest_(top, wanted, config.radius);
+                result.computed_distances = context.computed_distances_count - result.computed_distances;
+                result.visited_members = context.iteration_cycles - result.visited_members;
+                result.count = top.size();
+                callback(query_idx, result);
+            }
+        }
+
+        batch_result.computed_distances = context.computed_distances_count - computed_distances_before;
+        batch_result.visited_members = context.iteration_cycles - iteration_cycles_before;
+        return batch_result;
+    }
+
     /**
      *  @brief Identifies the closest cluster to the given ::query. Thread-safe.
      *
@@ -2899,11 +4165,16 @@ class index_gt {
 
     /**
      *  @brief  Saves serialized binary index representation to a stream.
+     *  @param[in] permutation Optional renumbering of the slots, like the one from `locality_order`,
+     *             to apply to the serialized nodes, leaving the index itself unchanged.
      */
     template <typename output_callback_at, typename progress_at = dummy_progress_t>
-    serialization_result_t save_to_stream(output_callback_at&& output, progress_at&& progress = {}) const noexcept {
+    serialization_result_t save_to_stream(output_callback_at&& output, progress_at&& progress = {},
+                                          slot_permutation_t const* permutation = nullptr) const noexcept {
 
         serialization_result_t result;
+        if (permutation && permutation->size() != nodes_count_)
+            return result.failed("Permutation doesn't match the index size");
 
         // Export some basic metadata
         index_serialized_header_t header;
@@ -2911,9 +4182,10 @@ class index_gt {
         header.connectivity = config_.connectivity;
         header.connectivity_base = config_.connectivity_base;
         header.max_level = max_level_;
-        header.entry_slot = entry_slot_;
+        header.entry_slot = permutation && nodes_count_ ? permutation->labels[static_cast<std::size_t>(entry_slot_)]
+                                                        : entry_slot_;
 
-        return storage_->save_nodes_to_stream(output, header, progress);
+        return storage_->save_nodes_to_stream(output, header, progress, permutation);
     }
 
     /**
@@ -2948,6 +4220,7 @@ class index_gt {
             reset();
             return result.failed("Out of memory");
         }
+        mirror_upper_levels_();
         return {};
     }
 
@@ -3101,6 +4374,7 @@ class index_gt {
         nodes_count_ = header.size;
         max_level_ = static_cast<level_t>(header.max_level);
         entry_slot_ = static_cast<compressed_slot_t>(header.entry_slot);
+        mirror_upper_levels_();
 
         return {};
     }
@@ -3112,6 +4386,11 @@ class index_gt {
         storage_->set_node_retriever(retriever_ctx, external_node_retriever, external_node_retriever_mut);
     }
 
+    using node_retriever_batch_t = typename storage_t::node_retriever_batch_t;
+    void set_node_retriever_batch(node_retriever_batch_t external_node_retriever_batch) noexcept {
+        storage_->set_node_retriever_batch(external_node_retriever_batch);
+    }
+
     typename storage_t::storage_metadata storage_metadata() noexcept { return storage_->metadata(); }
 
   private:
@@ -3131,8 +4410,10 @@ class index_gt {
             // TODO: Handle out of memory conditions
             search_to_insert_(value, metric, prefetch, closest_slot, node_slot, level, config.expansion, context);
             closest_slot = connect_new_node_(metric, node_slot, level, context);
-            reconnect_neighbor_nodes_(metric, node_slot, value, level, context);
+            neighbors_ref_t new_neighbors = storage_->get_node_at(node_slot).neighbors_(pre_, level);
+            reconnect_neighbor_nodes_(metric, node_slot, new_neighbors, value, level, context);
         }
+        mirror_upper_node_(node_slot);
     }
 
     template <typename metric_at>
@@ -3159,22 +4440,178 @@ class index_gt {
         return new_neighbors[0];
     }
 
-    template <typename value_at, typename metric_at>
-    void reconnect_neighbor_nodes_( //
-        metric_at&& metric, compressed_slot_t new_slot, value_at&& value, level_t level,
-        context_t& context) usearch_noexcept_m {
+    /**
+     *  @brief  Copies the neighbors list of @p slot at @p level into the @p context, without locking the node.
+     *          Like any "seqlock" reader, retries only if a writer has modified the node while it was copied,
+     *          so concurrent insertions into popular nodes don't stall the traversals passing through them.
+     */
+    neighbors_ref_t neighbors_snapshot_(compressed_slot_t slot, level_t level, context_t& context) const noexcept {
+        byte_t* snapshot = context.neighbors_snapshot.data();
+        std::size_t const snapshot_bytes = level ? pre_.neighbors_bytes : pre_.neighbors_base_bytes;
+        while (true) {
+            auto version = storage_->node_read_begin(slot);
+            node_t node = storage_->get_node_at(slot);
+            std::memcpy(snapshot, node.neighbors_(pre_, level).tape(), snapshot_bytes);
+            if (storage_->node_read_validate(slot, version))
+                return {snapshot};
+        }
+    }
 
-        node_t new_node = storage_->get_node_at(new_slot);
-        top_candidates_t& top = context.top_candidates;
-        neighbors_ref_t new_neighbors = new_node.neighbors_(pre_, level);
+    /// @brief  Copies the neighbors list of @p node at @p level into the @p context, while the caller holds its lock.
+    neighbors_ref_t neighbors_copy_(node_t node, level_t level, context_t& context) const noexcept {
+        byte_t* copy = context.neighbors_snapshot.data();
+        std::size_t const copy_bytes = level ? pre_.neighbors_bytes : pre_.neighbors_base_bytes;
+        std::memcpy(copy, node.neighbors_(pre_, level).tape(), copy_bytes);
+        return {copy};
+    }
+
+    /// @brief  Same as `neighbors_snapshot_` for an upper @p level, but copies the list from `upper_levels_`,
+    ///         if the node is mirrored there, leaving the storage untouched.
+    neighbors_ref_t upper_neighbors_snapshot_(compressed_slot_t slot, level_t level,
+                                              context_t& context) const noexcept {
+        byte_t const* entry = upper_levels_.find(slot);
+        if (!entry || upper_levels_.level(entry) < level)
+            return neighbors_snapshot_(slot, level, context);
+
+        byte_t* snapshot = context.neighbors_snapshot.data();
+        while (true) {
+            auto version = storage_->node_read_begin(slot);
+            std::memcpy(snapshot, upper_levels_.neighbors(entry, level).tape(), pre_.neighbors_bytes);
+            if (storage_->node_read_validate(slot, version))
+                return {snapshot};
+        }
+    }
 
-        // Reverse links from the neighbors:
-        std::size_t const connectivity_max = level ? config_.connectivity : config_.connectivity_base;
-        for (compressed_slot_t close_slot : new_neighbors) {
-            if (close_slot == new_slot)
-                continue;
-            node_lock_t close_lock = storage_->node_lock(close_slot);
-            node_t close_node = storage_->get_node_at_mut(close_slot);
+    /// @brief  Measures the distance to a node of the upper levels, using the vector mirrored in `upper_levels_`,
+    ///         if there is one, and the metric can score such vectors with its `stored` method.
+    template <typename value_at, typename metric_at>
+    distance_t measure_upper_(value_at const& query, compressed_slot_t slot, metric_at&& metric,
+                              context_t& context) const noexcept {
+        using metric_t = typename std::decay<metric_at>::type;
+        using value_t = typename std::decay<value_at>::type;
+        using stored_signature_t = distance_t(value_t const&, byte_t const*);
+        using has_stored_t = std::integral_constant<bool, has_stored_gt<metric_t, stored_signature_t>::value>;
+        return measure_upper_(query, slot, metric, context, has_stored_t{});
+    }
+
+    template <typename value_at, typename metric_at>
+    distance_t measure_upper_(value_at const& query, compressed_slot_t slot, metric_at&& metric, context_t& context,
+                              std::true_type) const noexcept {
+        byte_t const* entry = upper_levels_.find(slot);
+        byte_t const* vector = entry ? upper_levels_.vector(entry) : nullptr;
+        return vector ? context.measure_stored(query, vector, metric)
+                      : context.measure(query, citerator_at(slot), metric);
+    }
+
+    template <typename value_at, typename metric_at>
+    distance_t measure_upper_(value_at const& query, compressed_slot_t slot, metric_at&& metric, context_t& context,
+                              std::false_type) const noexcept {
+        return context.measure(query, citerator_at(slot), metric);
+    }
+
+    /**
+     *  @brief  Gathers the neighbors of a candidate, that haven't been visited yet, into `context.successors`,
+     *          marking them as visited, and scores them all at once into `context.successors_distances`.
+     *  @return The number of gathered neighbors.
+     */
+    template <typename value_at, typename metric_at>
+    std::size_t measure_successors_(value_at const& query, neighbors_ref_t neighbors, visits_set_t& visits,
+                                    metric_at&& metric, context_t& context) const noexcept {
+        compressed_slot_t* successors = context.successors.data();
+        std::size_t count = 0;
+        for (compressed_slot_t successor_slot : neighbors)
+            if (!visits.set(successor_slot))
+                successors[count++] = successor_slot;
+        measure_many_(query, successors, count, metric, context);
+        return count;
+    }
+
+    /// @brief  Measures the distances to many nodes, using the `batch` method of the metric, if it has one,
+    ///         to fetch all of the vectors first and stream them through a one-to-many kernel.
+    template <typename value_at, typename metric_at>
+    void measure_many_(value_at const& query, compressed_slot_t const* slots, std::size_t count, metric_at&& metric,
+                       context_t& context) const noexcept {
+        using metric_t = typename std::decay<metric_at>::type;
+        using value_t = typename std::decay<value_at>::type;
+        using batch_signature_t = void(value_t const&, compressed_slot_t const*, std::size_t, distance_t*);
+        using has_batch_t = std::integral_constant<bool, has_batch_gt<metric_t, batch_signature_t>::value>;
+        measure_many_(query, slots, count, metric, context, has_batch_t{});
+    }
+
+    template <typename value_at, typename metric_at>
+    void measure_many_(value_at const& query, compressed_slot_t const* slots, std::size_t count, metric_at&& metric,
+                       context_t& context, std::true_type) const noexcept {
+        context.computed_distances_count += count;
+        metric.batch(query, slots, count, context.successors_distances.data());
+    }
+
+    template <typename value_at, typename metric_at>
+    void measure_many_(value_at const& query, compressed_slot_t const* slots, std::size_t count, metric_at&& metric,
+                       context_t& context, std::false_type) const noexcept {
+        distance_t* distances = context.successors_distances.data();
+        for (std::size_t i = 0; i != count; ++i)
+            distances[i] = context.measure(query, citerator_at(slots[i]), metric);
+    }
+
+    /**
+     *  @brief  Copies the node in @p slot into `upper_levels_`, if it rises above the base level.
+     *          Must be called under the lock of the node, after every change of its upper levels or its vector.
+     */
+    bool mirror_upper_node_(compressed_slot_t slot) noexcept {
+        if (!upper_levels_)
+            return false;
+        node_t node = storage_->get_node_at(slot);
+        level_t const level = node.level();
+        if (level < 1)
+            return false;
+
+        // Vectors of unexpected sizes are left in the storage, like the ones of a storage without vectors
+        byte_t const* vector = storage_->stored_vector_size_bytes() == upper_levels_.vector_bytes()
+                                   ? storage_->get_stored_vector_at(slot)
+                                   : nullptr;
+        return upper_levels_.store(slot, level, node.neighbors_non_base_(pre_, 1).tape(), vector);
+    }
+
+    /**
+     *  @brief  Mirrors the upper levels from scratch, traversing them from the entry point,
+     *          so that the nodes of the base level are never fetched from the storage.
+     *          Must not run concurrently with any other operation.
+     */
+    void mirror_upper_levels_() noexcept {
+        upper_levels_.clear();
+        if (!upper_levels_ || !nodes_count_ || max_level_ < 1)
+            return;
+
+        // Every slot is queued once, after it is mirrored, so the queue can't outgrow the mirror
+        buffer_gt<compressed_slot_t> queue(upper_levels_.capacity());
+        if (!queue)
+            return;
+        std::size_t tail = 0;
+        if (mirror_upper_node_(entry_slot_))
+            queue[tail++] = entry_slot_;
+        for (std::size_t head = 0; head != tail; ++head) {
+            byte_t const* entry = upper_levels_.find(queue[head]);
+            for (level_t level = 1; level <= upper_levels_.level(entry); ++level)
+                for (compressed_slot_t neighbor_slot : upper_levels_.neighbors(entry, level))
+                    if (!upper_levels_.find(neighbor_slot) && mirror_upper_node_(neighbor_slot))
+                        queue[tail++] = neighbor_slot;
+        }
+    }
+
+    template <typename value_at, typename metric_at>
+    void reconnect_neighbor_nodes_( //
+        metric_at&& metric, compressed_slot_t new_slot, neighbors_ref_t new_neighbors, value_at&& value,
+        level_t level, context_t& context) usearch_noexcept_m {
+
+        top_candidates_t& top = context.top_candidates;
+
+        // Reverse links from the neighbors:
+        std::size_t const connectivity_max = level ? config_.connectivity : config_.connectivity_base;
+        for (compressed_slot_t close_slot : new_neighbors) {
+            if (close_slot == new_slot)
+                continue;
+            node_lock_t close_lock = storage_->node_lock(close_slot);
+            node_t close_node = storage_->get_node_at_mut(close_slot);
 
             neighbors_ref_t close_header = close_node.neighbors_(pre_, level);
             usearch_assert_m(close_header.size() <= connectivity_max, "Possible corruption");
@@ -3185,6 +4622,8 @@ class index_gt {
             // then no need to modify any connections or run the heuristics.
             if (close_header.size() < connectivity_max) {
                 close_header.push_back(static_cast<compressed_slot_t>(new_slot));
+                if (level)
+                    mirror_upper_node_(close_slot);
                 continue;
             }
 
@@ -3202,6 +4641,62 @@ class index_gt {
             candidates_view_t top_view = refine_(metric, connectivity_max, top, context);
             for (std::size_t idx = 0; idx != top_view.size(); idx++)
                 close_header.push_back(top_view[idx].slot);
+            if (level)
+                mirror_upper_node_(close_slot);
+        }
+    }
+
+    /**
+     *  @brief  Revises the lists of the former neighbors of an updated entry, that link back to it.
+     *          As the distances to it have changed, every such list is re-pruned together with the other
+     *          former neighbors, so that the links dropped by the heuristic get replaced, like on removal.
+     *  @param[in] moved_neighbors Copy of the former neighbors list, as the updated entry isn't locked.
+     */
+    template <typename metric_at>
+    void relink_moved_node_(                                                                       //
+        metric_at&& metric, compressed_slot_t moved_slot, neighbors_ref_t moved_neighbors, level_t level, //
+        context_t& context) usearch_noexcept_m {
+
+        top_candidates_t& top = context.top_candidates;
+        visits_set_t& visits = context.visits;
+
+        std::size_t const connectivity_max = level ? config_.connectivity : config_.connectivity_base;
+        for (compressed_slot_t close_slot : moved_neighbors) {
+            if (close_slot == moved_slot)
+                continue;
+            node_lock_t close_lock = storage_->node_lock(close_slot);
+            node_t close_node = storage_->get_node_at_mut(close_slot);
+            neighbors_ref_t close_header = close_node.neighbors_(pre_, level);
+
+            bool links_back = false;
+            for (compressed_slot_t successor_slot : close_header)
+                links_back |= successor_slot == moved_slot;
+            if (!links_back)
+                continue;
+
+            // The memory for both lists must have been reserved in `update`
+            top.clear();
+            visits.clear();
+            visits.set(close_slot);
+            auto insert_candidate = [&](compressed_slot_t successor_slot) {
+                if (visits.set(successor_slot))
+                    return;
+                distance_t successor_dist =
+                    context.measure(citerator_at(close_slot), citerator_at(successor_slot), metric);
+                top.insert_reserved({successor_dist, successor_slot});
+            };
+            for (compressed_slot_t successor_slot : close_header)
+                insert_candidate(successor_slot);
+            for (compressed_slot_t successor_slot : moved_neighbors)
+                insert_candidate(successor_slot);
+
+            // Export the results:
+            close_header.clear();
+            candidates_view_t top_view = refine_(metric, connectivity_max, top, context);
+            for (std::size_t idx = 0; idx != top_view.size(); idx++)
+                close_header.push_back(top_view[idx].slot);
+            if (level)
+                mirror_upper_node_(close_slot);
         }
     }
 
@@ -3246,7 +4741,9 @@ class index_gt {
                               std::size_t progress) noexcept
             : index_(index), neighbors_(neighbors), visits_(visits), current_(progress) {}
         candidates_iterator_t operator++(int) noexcept {
-            return candidates_iterator_t(index_, visits_, neighbors_, current_ + 1).skip_missing();
+            candidates_iterator_t old = *this;
+            ++*this;
+            return old;
         }
         candidates_iterator_t& operator++() noexcept {
             ++current_;
@@ -3256,7 +4753,7 @@ class index_gt {
         bool operator==(candidates_iterator_t const& other) noexcept { return current_ == other.current_; }
         bool operator!=(candidates_iterator_t const& other) noexcept { return current_ != other.current_; }
 
-        vector_key_t key() const noexcept { return index_->get_node_at(slot()).key(); }
+        vector_key_t key() const noexcept { return index_.storage_->get_node_at(slot()).key(); }
         compressed_slot_t slot() const noexcept { return neighbors_[current_]; }
         friend inline std::uint64_t get_slot(candidates_iterator_t const& it) noexcept { return it.slot(); }
         friend inline vector_key_t get_key(candidates_iterator_t const& it) noexcept { return it.key(); }
@@ -3281,28 +4778,27 @@ class index_gt {
         visits_set_t& visits = context.visits;
         visits.clear();
 
-        // Optional prefetching
-        if (!is_dummy<prefetch_at>())
+        // Optional prefetching, pointless if the upper levels are mirrored
+        bool const mirrored = upper_levels_.size();
+        if (!is_dummy<prefetch_at>() && !mirrored)
             prefetch(citerator_at(closest_slot), citerator_at(closest_slot + 1));
 
-        distance_t closest_dist = context.measure(query, citerator_at(closest_slot), metric);
+        distance_t closest_dist = measure_upper_(query, closest_slot, metric, context);
         for (level_t level = begin_level; level > end_level; --level) {
             bool changed;
             do {
                 changed = false;
-                node_lock_t closest_lock = storage_->node_lock(closest_slot);
-                node_t n = storage_->get_node_at(closest_slot);
-                neighbors_ref_t closest_neighbors = n.neighbors_non_base_(pre_, level);
+                neighbors_ref_t closest_neighbors = upper_neighbors_snapshot_(closest_slot, level, context);
 
                 // Optional prefetching
-                if (!is_dummy<prefetch_at>()) {
+                if (!is_dummy<prefetch_at>() && !mirrored) {
                     candidates_range_t missing_candidates{*this, closest_neighbors, visits};
                     prefetch(missing_candidates.begin(), missing_candidates.end());
                 }
 
                 // Actual traversal
                 for (compressed_slot_t candidate_slot : closest_neighbors) {
-                    distance_t candidate_dist = context.measure(query, citerator_at(candidate_slot), metric);
+                    distance_t candidate_dist = measure_upper_(query, candidate_slot, metric, context);
                     if (candidate_dist < closest_dist) {
                         closest_dist = candidate_dist;
                         closest_slot = candidate_slot;
@@ -3315,6 +4811,89 @@ class index_gt {
         return closest_slot;
     }
 
+    /**
+     *  @brief  Descends the upper levels of the graph for a whole batch of queries, tracking only the closest
+     *          match of every query, exactly like `search_for_one_` would. Queries standing at the same node
+     *          are grouped together, so that its neighbors list is fetched and locked once per group.
+     *
+     *  @param[out] closest_slots Closest base-layer entry point for every query.
+     *  @param[out] closest_distances Distances from every query to its entry point.
+     *  @param distances Temporary space for `queries_count` distances.
+     *  @param active_queries Temporary space for `queries_count` query indices.
+     */
+    template <typename queries_at, typename metric_at, typename prefetch_at = dummy_prefetch_t>
+    void search_for_many_(                                                                           //
+        queries_at&& queries, std::size_t queries_count, metric_at&& metric, prefetch_at&& prefetch, //
+        compressed_slot_t* closest_slots, distance_t* closest_distances, distance_t* distances,      //
+        std::size_t* active_queries, context_t& context) const noexcept {
+
+        visits_set_t& visits = context.visits;
+        visits.clear();
+
+        compressed_slot_t const entry_slot = entry_slot_;
+
+        // Optional prefetching
+        if (!is_dummy<prefetch_at>())
+            prefetch(citerator_at(entry_slot), citerator_at(entry_slot + 1));
+
+        for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx)
+            closest_slots[query_idx] = entry_slot, active_queries[query_idx] = query_idx;
+        context.measure_batch(queries, active_queries, queries_count, citerator_at(entry_slot), metric,
+                              closest_distances);
+
+        for (level_t level = max_level_; level > 0; --level) {
+            // Every query scans the neighbors of its closest node at least once per level
+            std::size_t active_count = queries_count;
+            for (std::size_t query_idx = 0; query_idx != queries_count; ++query_idx)
+                active_queries[query_idx] = query_idx;
+
+            while (active_count) {
+                std::sort(active_queries, active_queries + active_count, [=](std::size_t a, std::size_t b) {
+                    return closest_slots[a] < closest_slots[b];
+                });
+
+                // Queries, that have moved to a closer node, are compacted into the head of `active_queries`
+                std::size_t moved_count = 0;
+                for (std::size_t group_begin = 0, group_end = 0; group_begin != active_count;
+                     group_begin = group_end) {
+                    compressed_slot_t const group_slot = closest_slots[active_queries[group_begin]];
+                    for (group_end = group_begin + 1; group_end != active_count; ++group_end)
+                        if (closest_slots[active_queries[group_end]] != group_slot)
+                            break;
+
+                    std::size_t const* group = active_queries + group_begin;
+                    std::size_t const group_size = group_end - group_begin;
+                    {
+                        neighbors_ref_t group_neighbors = upper_neighbors_snapshot_(group_slot, level, context);
+
+                        // Optional prefetching
+                        if (!is_dummy<prefetch_at>()) {
+                            candidates_range_t missing_candidates{*this, group_neighbors, visits};
+                            prefetch(missing_candidates.begin(), missing_candidates.end());
+                        }
+
+                        for (compressed_slot_t candidate_slot : group_neighbors) {
+                            context.measure_batch(queries, group, group_size, citerator_at(candidate_slot), metric,
+                                                  distances);
+                            for (std::size_t i = 0; i != group_size; ++i) {
+                                if (distances[i] < closest_distances[group[i]]) {
+                                    closest_distances[group[i]] = distances[i];
+                                    closest_slots[group[i]] = candidate_slot;
+                                }
+                            }
+                        }
+                    }
+                    context.iteration_cycles += group_size;
+
+                    for (std::size_t i = 0; i != group_size; ++i)
+                        if (closest_slots[group[i]] != group_slot)
+                            active_queries[moved_count++] = group[i];
+                }
+                active_count = moved_count;
+            }
+        }
+    }
+
     /**
      *  @brief  Traverses a layer of a graph, to find the best place to insert a new node.
      *          Locks the nodes in the process, assuming other threads are updating neighbors lists.
@@ -3344,6 +4923,8 @@ class index_gt {
         next.insert_reserved({-radius, static_cast<compressed_slot_t>(start_slot)});
         top.insert_reserved({radius, static_cast<compressed_slot_t>(start_slot)});
         visits.set(start_slot);
+        // An updated node may still be reachable through the old links, but must never link to itself
+        visits.set(new_slot);
 
         while (!next.empty()) {
 
@@ -3356,9 +4937,7 @@ class index_gt {
             compressed_slot_t candidate_slot = candidacy.slot;
             if (new_slot == candidate_slot)
                 continue;
-            node_t candidate_ref = storage_->get_node_at(candidate_slot);
-            node_lock_t candidate_lock = storage_->node_lock(candidate_slot);
-            neighbors_ref_t candidate_neighbors = candidate_ref.neighbors_(pre_, level);
+            neighbors_ref_t candidate_neighbors = neighbors_snapshot_(candidate_slot, level, context);
 
             // Optional prefetching
             if (!is_dummy<prefetch_at>()) {
@@ -3367,18 +4946,16 @@ class index_gt {
             }
 
             // Assume the worst-case when reserving memory
-            if (visits_container_type_ak != 'B') {
+            if (!visits_by_slot_k) {
                 if (!visits.reserve(visits.size() + candidate_neighbors.size()))
                     return false;
             }
 
-            for (compressed_slot_t successor_slot : candidate_neighbors) {
-                if (visits.set(successor_slot))
-                    continue;
-
-                context.iteration_cycles++;
-                // node_lock_t successor_lock = node_lock_(successor_slot);
-                distance_t successor_dist = context.measure(query, citerator_at(successor_slot), metric);
+            std::size_t successors_count = measure_successors_(query, candidate_neighbors, visits, metric, context);
+            context.iteration_cycles += successors_count;
+            for (std::size_t i = 0; i != successors_count; ++i) {
+                compressed_slot_t successor_slot = context.successors[i];
+                distance_t successor_dist = context.successors_distances[i];
                 if (top.size() < top_limit || successor_dist < radius) {
                     // This can substantially grow our priority queue:
                     next.insert({-successor_dist, successor_slot});
@@ -3399,11 +4976,9 @@ class index_gt {
     template <typename value_at, typename metric_at, typename predicate_at, typename prefetch_at>
     bool search_to_find_in_base_(                                                               //
         value_at&& query, metric_at&& metric, predicate_at&& predicate, prefetch_at&& prefetch, //
-        compressed_slot_t start_slot, std::size_t expansion, context_t& context,
-        bool continue_search = false) const noexcept {
+        compressed_slot_t start_slot, std::size_t expansion, context_t& context) const noexcept {
 
         visits_set_t& visits = context.visits;
-        visits_set_t& consumed = context.consumed;
         next_candidates_t& next = context.next_candidates; // pop min, push
         top_candidates_t& top = context.top_candidates;    // pop max, push
         std::size_t const top_limit = expansion;
@@ -3412,21 +4987,7 @@ class index_gt {
             return false;
 
         visits.clear();
-        if (!continue_search) {
-            consumed.clear();
-            next.clear();
-        } else {
-            // When continuing search, we resume consuming from next, whereever we left off
-            usearch_assert_m(top.size() > 0, "index must be non-empty for search");
-            // start from the last result we returned
-            start_slot = top.bottom().slot;
-
-            // Save previously returned results to not return them again
-            if (!consumed.reserve(consumed.size() + top.size()))
-                return false;
-            while (top.size() > 0)
-                consumed.set(top.pop().slot);
-        }
+        next.clear();
         top.clear();
 
         // Optional prefetching
@@ -3435,8 +4996,7 @@ class index_gt {
 
         distance_t radius = context.measure(query, citerator_at(start_slot), metric);
         next.insert_reserved({-radius, static_cast<compressed_slot_t>(start_slot)});
-        if (!continue_search)
-            top.insert_reserved({radius, static_cast<compressed_slot_t>(start_slot)});
+        top.insert_reserved({radius, static_cast<compressed_slot_t>(start_slot)});
         visits.set(start_slot);
 
         while (!next.empty()) {
@@ -3456,17 +5016,16 @@ class index_gt {
             }
 
             // Assume the worst-case when reserving memory
-            if (visits_container_type_ak != 'B') {
+            if (!visits_by_slot_k) {
                 if (!visits.reserve(visits.size() + candidate_neighbors.size()))
                     return false;
             }
 
-            for (compressed_slot_t successor_slot : candidate_neighbors) {
-                if (visits.set(successor_slot) || (continue_search && consumed.test(successor_slot)))
-                    continue;
-
-                context.iteration_cycles++;
-                distance_t successor_dist = context.measure(query, citerator_at(successor_slot), metric);
+            std::size_t successors_count = measure_successors_(query, candidate_neighbors, visits, metric, context);
+            context.iteration_cycles += successors_count;
+            for (std::size_t i = 0; i != successors_count; ++i) {
+                compressed_slot_t successor_slot = context.successors[i];
+                distance_t successor_dist = context.successors_distances[i];
                 if (top.size() < top_limit || successor_dist < radius) {
                     // This can substantially grow our priority queue:
                     next.insert({-successor_dist, successor_slot});
@@ -3484,14 +5043,329 @@ class index_gt {
         return true;
     }
 
+    /**
+     *  @brief  Reserves the candidate queues and traverses the @b base layer, starting from @p closest_slot.
+     *  @return `true` if procedure succeeded, `false` if run out of memory.
+     */
+    template <typename value_at, typename metric_at, typename predicate_at, typename prefetch_at>
+    bool search_in_base_(                                                                              //
+        value_at&& query, std::size_t wanted, metric_at&& metric, index_search_config_t const& config, //
+        predicate_at&& predicate, prefetch_at&& prefetch, compressed_slot_t closest_slot,              //
+        context_t& context) const noexcept {
+
+        std::size_t expansion = (std::max)(config.expansion, wanted);
+        if (!context.next_candidates.reserve(expansion))
+            return false;
+        if (!context.top_candidates.reserve(expansion))
+            return false;
+        return search_to_find_in_base_(query, metric, predicate, prefetch, closest_slot, expansion, context);
+    }
+
+    /**
+     *  @brief  Adds a discovered entry to the matches of the @p cursor, if it passes the @p predicate,
+     *          keeping the @p expansion closest ones in the `top_` and spilling the farther ones to the `rest_`.
+     *  @return `true` if procedure succeeded, `false` if run out of memory.
+     */
+    template <typename predicate_at>
+    bool collect_into_cursor_(search_cursor_t& cursor, compressed_slot_t slot, distance_t distance,
+                              std::size_t expansion, predicate_at&& predicate) const noexcept {
+
+        if (!is_dummy<predicate_at>())
+            if (!predicate(member_cref_t{storage_->get_node_at(slot).ckey(), slot}))
+                return true;
+
+        top_candidates_t& top = cursor.top_;
+        if (top.size() == expansion) {
+            candidate_t farthest = top.top();
+            if (distance >= farthest.distance)
+                return cursor.rest_.insert({-distance, slot});
+            top.pop();
+            if (!cursor.rest_.insert({-farthest.distance, farthest.slot}))
+                return false;
+        }
+        top.insert_reserved({distance, slot});
+        return true;
+    }
+
+    /**
+     *  @brief  Continues traversing the @b base layer of a graph from the frontier of the @p cursor,
+     *          until none of the unexpanded entries is closer than the farthest of @p expansion matches.
+     *          Unlike `search_to_find_in_base_`, keeps every discovered entry, so a later call can resume.
+     *  @return `true` if procedure succeeded, `false` if run out of memory.
+     */
+    template <typename value_at, typename metric_at, typename predicate_at, typename prefetch_at>
+    bool search_to_resume_in_base_(                                                              //
+        search_cursor_t& cursor, value_at&& query, metric_at&& metric, predicate_at&& predicate, //
+        prefetch_at&& prefetch, std::size_t expansion, context_t& context) const noexcept {
+
+        visits_set_t& visits = cursor.visits_;
+        next_candidates_t& next = cursor.next_; // pop min, push
+        top_candidates_t& top = cursor.top_;    // pop max, push
+
+        while (!next.empty()) {
+
+            candidate_t candidate = next.top();
+            if (top.size() == expansion && (-candidate.distance) > top.top().distance)
+                break;
+
+            next.pop();
+
+            neighbors_ref_t candidate_neighbors = storage_->get_node_at(candidate.slot).neighbors_base_();
+
+            // Optional prefetching
+            if (!is_dummy<prefetch_at>()) {
+                candidates_range_t missing_candidates{*this, candidate_neighbors, visits};
+                prefetch(missing_candidates.begin(), missing_candidates.end());
+            }
+
+            // Assume the worst-case when reserving memory
+            if (!visits_by_slot_k) {
+                if (!visits.reserve(visits.size() + candidate_neighbors.size()))
+                    return false;
+            }
+
+            std::size_t successors_count = measure_successors_(query, candidate_neighbors, visits, metric, context);
+            context.iteration_cycles += successors_count;
+            for (std::size_t i = 0; i != successors_count; ++i) {
+                compressed_slot_t successor_slot = context.successors[i];
+                distance_t successor_dist = context.successors_distances[i];
+                if (!next.insert({-successor_dist, successor_slot}))
+                    return false;
+                if (!collect_into_cursor_(cursor, successor_slot, successor_dist, expansion, predicate))
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     *  @brief  Traverses the @b base layer of a graph, collecting all the entries within the @p radius.
+     *          Besides the usual beam of @p expansion closest entries, every entry within the @p radius
+     *          is expanded. Once @p limit matches are found, the @p radius shrinks to the farthest of them.
+     *  @return `true` if procedure succeeded, `false` if run out of memory.
+     */
+    template <typename value_at, typename metric_at, typename predicate_at, typename prefetch_at>
+    bool search_to_find_in_range_(                                                              //
+        value_at&& query, metric_at&& metric, predicate_at&& predicate, prefetch_at&& prefetch, //
+        compressed_slot_t start_slot, std::size_t expansion, distance_t radius, std::size_t limit,
+        context_t& context) const noexcept {
+
+        visits_set_t& visits = context.visits;
+        next_candidates_t& next = context.next_candidates;  // pop min, push
+        top_candidates_t& top = context.top_candidates;     // pop max, push
+        next_candidates_t& found = context.range_candidates; // pop max, push
+        std::size_t const top_limit = (std::max<std::size_t>)(expansion, 1u);
+
+        if (!visits.reserve(config_.connectivity_base + 1u))
+            return false;
+        visits.clear();
+        next.clear();
+        top.clear();
+
+        // Matches are kept in a max-heap, so that the farthest can be dropped once over the `limit`
+        auto collect = [&](compressed_slot_t slot, distance_t distance) {
+            if (distance > radius)
+                return true;
+            if (!is_dummy<predicate_at>())
+                if (!predicate(member_cref_t{storage_->get_node_at(slot).ckey(), slot}))
+                    return true;
+            if (!found.insert({distance, slot}))
+                return false;
+            if (found.size() > limit) {
+                found.pop();
+                radius = found.top().distance;
+            }
+            return true;
+        };
+
+        distance_t start_dist = context.measure(query, citerator_at(start_slot), metric);
+        distance_t top_radius = start_dist;
+        next.insert_reserved({-start_dist, start_slot});
+        top.insert_reserved({start_dist, start_slot});
+        visits.set(start_slot);
+        if (!collect(start_slot, start_dist))
+            return false;
+
+        while (!next.empty()) {
+
+            candidate_t candidate = next.top();
+            if ((-candidate.distance) > radius && (-candidate.distance) > top_radius && top.size() == top_limit)
+                break;
+
+            next.pop();
+            context.iteration_cycles++;
+
+            neighbors_ref_t candidate_neighbors = storage_->get_node_at(candidate.slot).neighbors_base_();
+
+            // Optional prefetching
+            if (!is_dummy<prefetch_at>()) {
+                candidates_range_t missing_candidates{*this, candidate_neighbors, visits};
+                prefetch(missing_candidates.begin(), missing_candidates.end());
+            }
+
+            // Assume the worst-case when reserving memory
+            if (!visits_by_slot_k) {
+                if (!visits.reserve(visits.size() + candidate_neighbors.size()))
+                    return false;
+            }
+
+            std::size_t successors_count = measure_successors_(query, candidate_neighbors, visits, metric, context);
+            for (std::size_t i = 0; i != successors_count; ++i) {
+                compressed_slot_t successor_slot = context.successors[i];
+                distance_t successor_dist = context.successors_distances[i];
+                if (!collect(successor_slot, successor_dist))
+                    return false;
+
+                bool within_beam = top.size() < top_limit || successor_dist < top_radius;
+                if (!within_beam && successor_dist > radius)
+                    continue;
+                if (!next.insert({-successor_dist, successor_slot}))
+                    return false;
+                if (within_beam) {
+                    top.insert({successor_dist, successor_slot}, top_limit);
+                    top_radius = top.top().distance;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     *  @brief  Traverses the @b base layer of a graph, expanding only the entries passing the @p predicate.
+     *          The rejected neighbors are looked through, scoring the allowed neighbors of theirs instead.
+     *  @return `true` if procedure succeeded, `false` if run out of memory.
+     */
+    template <typename value_at, typename metric_at, typename predicate_at, typename prefetch_at>
+    bool search_to_find_in_filtered_base_(                                                      //
+        value_at&& query, metric_at&& metric, predicate_at&& predicate, prefetch_at&& prefetch, //
+        compressed_slot_t start_slot, std::size_t expansion, context_t& context) const noexcept {
+
+        visits_set_t& visits = context.visits;
+        next_candidates_t& next = context.next_candidates; // pop min, push
+        top_candidates_t& top = context.top_candidates;    // pop max, push
+        std::size_t const top_limit = expansion;
+
+        if (!visits.reserve(config_.connectivity_base + 1u))
+            return false;
+        visits.clear();
+        next.clear();
+        top.clear();
+
+        auto allowed = [&](compressed_slot_t slot) {
+            return predicate(member_cref_t{storage_->get_node_at(slot).ckey(), slot});
+        };
+        distance_t radius = context.measure(query, citerator_at(start_slot), metric);
+        next.insert_reserved({-radius, static_cast<compressed_slot_t>(start_slot)});
+        if (allowed(start_slot))
+            top.insert_reserved({radius, static_cast<compressed_slot_t>(start_slot)});
+        visits.set(start_slot);
+
+        auto consider = [&](compressed_slot_t successor_slot) {
+            context.iteration_cycles++;
+            distance_t successor_dist = context.measure(query, citerator_at(successor_slot), metric);
+            if (top.size() < top_limit || successor_dist < radius) {
+                next.insert({-successor_dist, successor_slot});
+                top.insert({successor_dist, successor_slot}, top_limit);
+                radius = top.top().distance;
+            }
+        };
+
+        while (!next.empty()) {
+
+            candidate_t candidate = next.top();
+            if ((-candidate.distance) > radius && top.size() == top_limit)
+                break;
+
+            next.pop();
+
+            neighbors_ref_t candidate_neighbors = storage_->get_node_at(candidate.slot).neighbors_base_();
+
+            // Optional prefetching
+            if (!is_dummy<prefetch_at>()) {
+                candidates_range_t missing_candidates{*this, candidate_neighbors, visits};
+                prefetch(missing_candidates.begin(), missing_candidates.end());
+            }
+
+            // Assume the worst-case when reserving memory
+            if (!visits_by_slot_k) {
+                if (!visits.reserve(visits.size() + candidate_neighbors.size()))
+                    return false;
+            }
+
+            // Like in ACORN, the allowed direct neighbors are scored first, and the allowed neighbors
+            // of the rejected ones fill the rest, up to the size of an ordinary neighbors list
+            std::size_t budget = config_.connectivity_base;
+            for (compressed_slot_t successor_slot : candidate_neighbors) {
+                if (!budget)
+                    break;
+                if (visits.test(successor_slot) || !allowed(successor_slot))
+                    continue;
+                visits.set(successor_slot);
+                consider(successor_slot);
+                --budget;
+            }
+            for (compressed_slot_t successor_slot : candidate_neighbors) {
+                if (!budget)
+                    break;
+                if (visits.test(successor_slot))
+                    continue;
+
+                // Rejected entries are never expanded themselves, so they are marked visited once looked through
+                visits.set(successor_slot);
+                neighbors_ref_t hop_neighbors = storage_->get_node_at(successor_slot).neighbors_base_();
+                if (!visits_by_slot_k) {
+                    if (!visits.reserve(visits.size() + hop_neighbors.size()))
+                        return false;
+                }
+                for (compressed_slot_t hop_slot : hop_neighbors) {
+                    if (!budget)
+                        break;
+                    if (visits.test(hop_slot) || !allowed(hop_slot))
+                        continue;
+                    visits.set(hop_slot);
+                    consider(hop_slot);
+                    --budget;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /// @brief  Estimates the fraction of entries passing the @p predicate from evenly spaced samples.
+    template <typename predicate_at> double estimate_selectivity_(predicate_at&& predicate) const noexcept {
+        std::size_t const count = size();
+        std::size_t const samples = (std::min)(count, selectivity_samples_k);
+        std::size_t passed = 0;
+        for (std::size_t i = 0; i != samples; ++i)
+            passed += predicate(at(i * count / samples)) ? 1 : 0;
+        // Half a sample keeps a predicate, that passed none, from looking impossible to satisfy
+        return (passed + 0.5) / (samples + 1.0);
+    }
+
+    /**
+     *  @brief  Sorts the found candidates, keeping up to @p wanted closest ones, within the @p radius.
+     */
+    void keep_closest_(top_candidates_t& top, std::size_t wanted, double radius) const noexcept {
+        top.sort_ascending();
+        top.shrink(wanted);
+
+        // Drop the sorted tail of matches outside of the radius
+        std::size_t within_radius = top.size();
+        while (within_radius && top.data()[within_radius - 1].distance > radius)
+            --within_radius;
+        top.shrink(within_radius);
+    }
+
     /**
      *  @brief  Iterates through all members, without actually touching the index.
      */
     template <typename value_at, typename metric_at, typename predicate_at>
     void search_exact_(                                                 //
         value_at&& query, metric_at&& metric, predicate_at&& predicate, //
-        std::size_t count, context_t& context, bool continue_search = false) const noexcept {
-        usearch_assert_m(!continue_search, "continuing exact search is not implemented");
+        std::size_t count, context_t& context) const noexcept {
 
         top_candidates_t& top = context.top_candidates;
         top.clear();
@@ -15,6 +15,11 @@
 #include <shared_mutex> // `std::shared_mutex`
 #endif
 
+// Instantiating the traversals for the metrics specialized at compile time roughly doubles the build time
+#if !defined(USEARCH_USE_FIXED_METRICS)
+#define USEARCH_USE_FIXED_METRICS 1
+#endif
+
 namespace unum {
 namespace usearch {
 
@@ -327,37 +332,172 @@ class index_dense_gt {
     using member_iterator_t = typename index_t::member_iterator_t;
     using member_citerator_t = typename index_t::member_citerator_t;
 
+    /// @brief A casted query of a batched search, with its optional lookup table for quantized vectors.
+    struct query_t {
+        byte_t const* vector;
+        float const* lookup_table;
+    };
+
     /// @brief Punned metric object.
-    class metric_proxy_t {
+    /// @brief Adapts a metric over vectors to the members of the index. Unless @p metric_at is the punned `metric_t`
+    ///         of the index, it is a stateless metric, specialized at compile time, as picked by `visit_metric_`.
+    template <typename metric_at> class metric_proxy_gt {
         index_dense_gt const* index_ = nullptr;
+        metric_at metric_{};
         // todo:: unnecessary outside of pq: make it compile time constant
         std::size_t thread_{};
         size_t bytes_per_vector_{};
+        /// Per-query table for asymmetric distance computations, if the query is scored against quantized vectors
+        float const* lookup_table_{};
 
       public:
-        metric_proxy_t(index_dense_gt const& index, std::size_t thread) noexcept
-            : index_(&index), thread_(thread), bytes_per_vector_(index_->metric_.bytes_per_vector()) {}
-
-        inline distance_t operator()(byte_t const* a, member_cref_t b) const noexcept { return f(a, v(b, false)); }
+        metric_proxy_gt(index_dense_gt const& index, std::size_t thread, float const* lookup_table,
+                        metric_at metric) noexcept
+            : index_(&index), metric_(metric), thread_(thread), bytes_per_vector_(index_->metric_.bytes_per_vector()),
+              lookup_table_(lookup_table) {}
+        metric_proxy_gt(index_dense_gt const& index, std::size_t thread, float const* lookup_table = nullptr) noexcept
+            : metric_proxy_gt(index, thread, lookup_table, index.metric_) {}
+
+        inline distance_t operator()(byte_t const* a, member_cref_t b) const noexcept {
+            return lookup_table_ ? l(get_slot(b)) : f_stored(a, v(b, false));
+        }
         inline distance_t operator()(member_cref_t a, member_cref_t b) const noexcept {
-            return f(v(a, true), v(b, false));
+            return f_stored(v(a, true), v(b, false));
         }
 
-        inline distance_t operator()(byte_t const* a, member_citerator_t b) const noexcept { return f(a, v(b, false)); }
+        inline distance_t operator()(byte_t const* a, member_citerator_t b) const noexcept {
+            return lookup_table_ ? l(get_slot(b)) : f_stored(a, v(b, false));
+        }
         inline distance_t operator()(member_citerator_t a, member_citerator_t b) const noexcept {
-            return f(v(a, true), v(b, false));
+            return f_stored(v(a, true), v(b, false));
         }
 
         inline distance_t operator()(byte_t const* a, byte_t const* b) const noexcept { return f(a, b); }
 
-        inline byte_t const* v(member_citerator_t m, bool left_v) const noexcept {
+        inline distance_t operator()(query_t const& a, member_cref_t b) const noexcept {
+            return a.lookup_table ? l(a.lookup_table, get_slot(b)) : f_stored(a.vector, v(b, false));
+        }
+        inline distance_t operator()(query_t const& a, member_citerator_t b) const noexcept {
+            return a.lookup_table ? l(a.lookup_table, get_slot(b)) : f_stored(a.vector, v(b, false));
+        }
+
+        /// Scores a vector of the storage, copied out of it, like the ones mirrored with the upper levels of the graph
+        inline distance_t stored(byte_t const* a, byte_t const* b) const noexcept {
+            return lookup_table_ ? l_stored(lookup_table_, b) : f_stored(a, decode(b));
+        }
+        inline distance_t stored(query_t const& a, byte_t const* b) const noexcept {
+            return a.lookup_table ? l_stored(a.lookup_table, b) : f_stored(a.vector, decode(b));
+        }
+
+        /// Scores one member against many queries, fetching and decompressing its vector only once
+        inline void batch(member_citerator_t b, query_t const* queries, std::size_t const* query_ids,
+                          std::size_t count, distance_t* distances) const noexcept {
+            if (!count)
+                return;
+            if (queries[query_ids[0]].lookup_table) {
+                std::size_t slot = get_slot(b);
+                for (std::size_t i = 0; i != count; ++i)
+                    distances[i] = l(queries[query_ids[i]].lookup_table, slot);
+                return;
+            }
+            byte_t const* vector = v(b, false);
+            // The one-to-many kernels add up the products in the same order, as the aligned ones
+            if (!metric_.batched() || !is_aligned(vector)) {
+                for (std::size_t i = 0; i != count; ++i)
+                    distances[i] = f_stored(queries[query_ids[i]].vector, vector);
+                return;
+            }
+            byte_t const* query_vectors[prefetch_batch_k];
+            for (std::size_t offset = 0; offset < count; offset += prefetch_batch_k) {
+                std::size_t const chunk = (std::min)(count - offset, prefetch_batch_k);
+                for (std::size_t i = 0; i != chunk; ++i)
+                    query_vectors[i] = queries[query_ids[offset + i]].vector;
+                metric_.batch(vector, query_vectors, chunk, distances + offset);
+            }
+        }
+
+        /// Scores one query against many members, streaming full-precision vectors through one-to-many kernels
+        inline void batch(byte_t const* a, compressed_slot_t const* slots, std::size_t count,
+                          distance_t* distances) const noexcept {
+            batch_slots(a, lookup_table_, slots, count, distances);
+        }
+        inline void batch(query_t const& a, compressed_slot_t const* slots, std::size_t count,
+                          distance_t* distances) const noexcept {
+            batch_slots(a.vector, a.lookup_table, slots, count, distances);
+        }
+        inline void batch_slots(byte_t const* a, float const* lookup_table, compressed_slot_t const* slots,
+                                std::size_t count, distance_t* distances) const noexcept {
+            if (lookup_table) {
+                for (std::size_t i = 0; i != count; ++i)
+                    distances[i] = l(lookup_table, slots[i]);
+                return;
+            }
+            // Quantized vectors are decompressed into a single per-thread buffer, one at a time
+            if (index_->storage_.encoded_vector_bytes()) {
+                for (std::size_t i = 0; i != count; ++i)
+                    distances[i] = f_stored(a, v(slots[i]));
+                return;
+            }
+            byte_t const* vectors[prefetch_batch_k];
+            for (std::size_t offset = 0; offset < count; offset += prefetch_batch_k) {
+                std::size_t const chunk = (std::min)(count - offset, prefetch_batch_k);
+                for (std::size_t i = 0; i != chunk; ++i)
+                    vectors[i] = index_->storage_.get_vector_at(slots[offset + i]);
+                metric_.batch(a, vectors, chunk, distances + offset);
+            }
+        }
+
+        inline byte_t const* v(member_citerator_t m, bool left_v) const noexcept { return v(get_slot(m), left_v); }
+        inline byte_t const* v(std::size_t slot, bool left_v = false) const noexcept {
             byte_t* decompressed_data =
                 index_->vector_decompress_buffer_.data() + bytes_per_vector_ * (2 * thread_ + (size_t)left_v);
             assert(bytes_per_vector_ * thread_ < index_->vector_decompress_buffer_.size());
-            return index_->storage_.get_vector_at(get_slot(m), decompressed_data);
+            return index_->storage_.get_vector_at(slot, decompressed_data);
+        }
+        inline byte_t const* decode(byte_t const* stored) const noexcept {
+            byte_t* decompressed_data = index_->vector_decompress_buffer_.data() + bytes_per_vector_ * (2 * thread_);
+            return index_->storage_.decode_vector(stored, decompressed_data);
         }
 
-        inline distance_t f(byte_t const* a, byte_t const* b) const noexcept { return index_->metric_(a, b); }
+        inline distance_t f(byte_t const* a, byte_t const* b) const noexcept { return metric_(a, b); }
+        /// Distance to a vector of the storage, passed as @p b, fetched with aligned loads if it is aligned.
+        /// Checked on every call, as vectors viewed from unaligned buffers may be added at any time.
+        inline distance_t f_stored(byte_t const* a, byte_t const* b) const noexcept {
+            return is_aligned(b) ? metric_.aligned(a, b) : metric_(a, b);
+        }
+        static bool is_aligned(byte_t const* vector) noexcept {
+            return reinterpret_cast<std::uintptr_t>(vector) % vector_alignment_k == 0;
+        }
+        inline distance_t l(std::size_t slot) const noexcept { return l(lookup_table_, slot); }
+        inline distance_t l(float const* lookup_table, std::size_t slot) const noexcept {
+            return index_->storage_.lookup_distance(lookup_table, index_->metric_.metric_kind(), slot);
+        }
+        inline distance_t l_stored(float const* lookup_table, byte_t const* stored) const noexcept {
+            return index_->storage_.lookup_stored_distance(lookup_table, index_->metric_.metric_kind(), stored);
+        }
+    };
+
+    using metric_proxy_t = metric_proxy_gt<metric_t>;
+
+    /// @brief Collects the slots of candidates about to be scored, so that the storage can prefetch them at once.
+    class prefetch_proxy_t {
+        storage_t const* storage_ = nullptr;
+
+      public:
+        prefetch_proxy_t(storage_t const& storage) noexcept : storage_(&storage) {}
+
+        template <typename member_citerator_like_at>
+        inline void operator()(member_citerator_like_at begin, member_citerator_like_at end) const noexcept {
+            std::uint64_t slots[prefetch_batch_k];
+            std::size_t count = 0;
+            for (; begin != end; ++begin) {
+                slots[count++] = get_slot(begin);
+                if (count == prefetch_batch_k)
+                    storage_->prefetch(slots, count), count = 0;
+            }
+            if (count)
+                storage_->prefetch(slots, count);
+        }
     };
 
     index_dense_config_t config_{};
@@ -365,6 +505,8 @@ class index_dense_gt {
 
     mutable std::vector<byte_t> cast_buffer_{};
     mutable std::vector<byte_t> vector_decompress_buffer_{};
+    /// @brief Per-thread tables for asymmetric distance computations, if the storage keeps quantized vectors.
+    mutable std::vector<float> lookup_tables_buffer_{};
     struct casts_t {
         cast_t from_b1x8;
         cast_t from_i8;
@@ -382,16 +524,16 @@ class index_dense_gt {
     /// @brief An instance of a potentially stateful `metric_t` used to initialize copies and forks.
     metric_t metric_;
 
+    /// @brief Dimensions of `metric_`, if `visit_metric_` can replace it with a specialized one, or zero otherwise.
+    std::size_t fixed_dimensions_ = 0;
+
     /// @brief The underlying storage provider for this index that determines file storage layout,
     /// implements serialization/deserialization routines, and provides an API to add, update and
     /// retrieve vectors and hnsw graph nodes.
     storage_t storage_{{}, config_};
 
-    /// @brief Originally forms and array of integers [0, threads], marking all.
-    mutable std::vector<std::size_t> available_threads_;
-
-    /// @brief Mutex, controlling concurrent access to `available_threads_`.
-    mutable std::mutex available_threads_mutex_;
+    /// @brief Lock-free pool of thread identifiers, indexing per-thread contexts and buffers.
+    mutable thread_slots_t available_threads_;
 
 #if defined(USEARCH_DEFINED_CPP17)
     using shared_mutex_t = std::shared_mutex;
@@ -431,19 +573,62 @@ class index_dense_gt {
     /// @brief Ring-shaped queue of deleted entries, to be reused on future insertions.
     ring_gt<compressed_slot_t> free_keys_;
 
-    /// @brief Mutex, controlling concurrent access to `free_keys_`.
+    /// @brief Queue of removed entries, that other entries may still link to, waiting for `isolate`.
+    ring_gt<compressed_slot_t> removed_slots_;
+
+    /// @brief Mutex, controlling concurrent access to `free_keys_` and `removed_slots_`.
     mutable std::mutex free_keys_mutex_;
 
+    /// @brief Mutex, serializing the passes of `isolate`, as each frees the slots it has unlinked.
+    std::mutex isolate_mutex_;
+
     /// @brief A constant for the reserved key value, used to mark deleted entries.
     vector_key_t free_key_ = default_free_value<vector_key_t>();
 
+    /// @brief The graph is repaired, once the removed entries make up 1/`repair_ratio_k` of all slots.
+    static constexpr std::size_t repair_ratio_k = 16;
+
+    /// @brief Number of vectors casted and encoded at once in `add_many`.
+    static constexpr std::size_t add_many_batch_k = 64;
+
+    /// @brief Number of queries casted and traversed together in `search_many`.
+    static constexpr std::size_t search_many_batch_k = 128;
+
+    /// @brief Number of candidate slots passed to `storage_t::prefetch` at once.
+    static constexpr std::size_t prefetch_batch_k = 64;
+
   public:
     using search_result_t = typename index_t::search_result_t;
+    using search_batch_result_t = typename index_t::search_batch_result_t;
     using cluster_result_t = typename index_t::cluster_result_t;
     using add_result_t = typename index_t::add_result_t;
     using stats_t = typename index_t::stats_t;
     using match_t = typename index_t::match_t;
     using node_retriever_t = typename index_t::node_retriever_t;
+    using node_retriever_batch_t = typename index_t::node_retriever_batch_t;
+
+    /**
+     *  @brief  Resumable search, that owns a casted copy of its query, as described in `index_gt::search_next`.
+     *          Created with `search_cursor` and advanced with `search_next`, possibly from different threads.
+     */
+    class search_cursor_t {
+        typename index_t::search_cursor_t traversal_{};
+        buffer_gt<byte_t> query_{};
+        buffer_gt<float> lookup_table_{};
+        index_search_config_t config_{};
+
+        friend class index_dense_gt;
+
+      public:
+        search_cursor_t() noexcept {}
+        search_cursor_t(search_cursor_t&&) = default;
+        search_cursor_t& operator=(search_cursor_t&&) = default;
+
+        /// @brief Whether the cursor has a query, unlike default-constructed or failed to allocate ones.
+        explicit operator bool() const noexcept { return static_cast<bool>(query_); }
+        /// @brief Whether all the matches, reachable in the graph, were returned.
+        bool exhausted() const noexcept { return traversal_.exhausted(); }
+    };
 
     index_dense_gt() = default;
     index_dense_gt(index_dense_gt&& other)
@@ -451,13 +636,16 @@ class index_dense_gt {
           typed_(exchange(other.typed_, nullptr)),                               //
           cast_buffer_(std::move(other.cast_buffer_)),                           //
           vector_decompress_buffer_(std::move(other.vector_decompress_buffer_)), //
+          lookup_tables_buffer_(std::move(other.lookup_tables_buffer_)),         //
           casts_(std::move(other.casts_)),                                       //
           metric_(std::move(other.metric_)),                                     //
+          fixed_dimensions_(other.fixed_dimensions_),                            //
           storage_(std::move(other.storage_)),                                   //
 
           available_threads_(std::move(other.available_threads_)), //
           slot_lookup_(std::move(other.slot_lookup_)),             //
           free_keys_(std::move(other.free_keys_)),                 //
+          removed_slots_(std::move(other.removed_slots_)),         //
           free_key_(std::move(other.free_key_)) {
         // Could do this in the _proxy pattern to void this
         // The problem will also go away if/when we make typed_ not do any allocations
@@ -479,13 +667,16 @@ class index_dense_gt {
         std::swap(typed_, other.typed_);
         std::swap(cast_buffer_, other.cast_buffer_);
         std::swap(vector_decompress_buffer_, other.vector_decompress_buffer_);
+        std::swap(lookup_tables_buffer_, other.lookup_tables_buffer_);
         std::swap(casts_, other.casts_);
         std::swap(metric_, other.metric_);
+        std::swap(fixed_dimensions_, other.fixed_dimensions_);
         std::swap(storage_, other.storage_);
 
         std::swap(available_threads_, other.available_threads_);
         std::swap(slot_lookup_, other.slot_lookup_);
         std::swap(free_keys_, other.free_keys_);
+        std::swap(removed_slots_, other.removed_slots_);
         std::swap(free_key_, other.free_key_);
         // Could do this in the _proxy pattern to void this
         // The problem will also go away if/when we make typed_ not do any allocations
@@ -517,11 +708,8 @@ class index_dense_gt {
         vector_key_t free_key = default_free_value<vector_key_t>()) {
 
         scalar_kind_t scalar_kind = metric.scalar_kind();
-        if (num_threads == 0) {
+        if (num_threads == 0)
             num_threads = std::thread::hardware_concurrency();
-        } else {
-            assert(num_threads <= std::thread::hardware_concurrency());
-        }
 
         index_dense_gt result;
         result.config_ = config;
@@ -529,12 +717,12 @@ class index_dense_gt {
         // the vector is used in measure() calls which touches at most 2 vectors at once
         result.vector_decompress_buffer_.resize(num_threads * metric.bytes_per_vector() * 2);
         result.casts_ = make_casts_(scalar_kind);
-        result.metric_ = metric;
+        result.change_metric(metric);
         result.free_key_ = free_key;
 
         // Fill the thread IDs.
-        result.available_threads_.resize(num_threads);
-        std::iota(result.available_threads_.begin(), result.available_threads_.end(), 0ul);
+        if (!result.available_threads_.reserve(num_threads))
+            return {};
 
         // Available since C11, but only C++17, so we use the C version.
         index_t* raw = index_allocator_t{}.allocate(1);
@@ -543,6 +731,7 @@ class index_dense_gt {
         } else {
             result.storage_ = storage_t(options, config);
         }
+        result.lookup_tables_buffer_.resize(num_threads * result.storage_.lookup_table_size());
         new (raw) index_t(&result.storage_, config);
         result.typed_ = raw;
         return result;
@@ -565,7 +754,7 @@ class index_dense_gt {
 
     explicit operator bool() const { return typed_; }
     std::size_t connectivity() const { return typed_->connectivity(); }
-    std::size_t size() const { return typed_->size() - free_keys_.size(); }
+    std::size_t size() const { return typed_->size() - free_keys_.size() - removed_slots_.size(); }
     std::size_t capacity() const { return typed_->capacity(); }
     std::size_t max_level() const noexcept { return typed_->max_level(); }
     index_dense_config_t const& config() const { return config_; }
@@ -575,7 +764,10 @@ class index_dense_gt {
 
     // The metric and its properties
     metric_t const& metric() const { return metric_; }
-    void change_metric(metric_t metric) { metric_ = std::move(metric); }
+    void change_metric(metric_t metric) {
+        metric_ = std::move(metric);
+        fixed_dimensions_ = fixed_dimensions_of_(metric_);
+    }
 
     scalar_kind_t scalar_kind() const noexcept { return metric_.scalar_kind(); }
     std::size_t bytes_per_vector() const noexcept { return metric_.bytes_per_vector(); }
@@ -633,11 +825,66 @@ class index_dense_gt {
     add_result_t add(vector_key_t key, f32_t const* vector, std::size_t thread = any_thread(), bool force_vector_copy = true,  level_t level = -1, compressed_slot_t slot = default_free_value<compressed_slot_t>()) { return add_(key, vector, thread, force_vector_copy, casts_.from_f32, level, slot); }
     add_result_t add(vector_key_t key, f64_t const* vector, std::size_t thread = any_thread(), bool force_vector_copy = true,  level_t level = -1, compressed_slot_t slot = default_free_value<compressed_slot_t>()) { return add_(key, vector, thread, force_vector_copy, casts_.from_f64, level, slot); }
 
-    search_result_t search(b1x8_t const* vector, std::size_t wanted, std::size_t thread = any_thread(), bool continue_search = false, bool exact = false) const { return search_(vector, wanted, thread, exact, casts_.from_b1x8, continue_search); }
-    search_result_t search(i8_t const* vector, std::size_t wanted, std::size_t thread = any_thread(), bool continue_search = false, bool exact = false) const { return search_(vector, wanted, thread, exact, casts_.from_i8, continue_search); }
-    search_result_t search(f16_t const* vector, std::size_t wanted, std::size_t thread = any_thread(), bool continue_search = false, bool exact = false) const { return search_(vector, wanted, thread, exact, casts_.from_f16, continue_search); }
-    search_result_t search(f32_t const* vector, std::size_t wanted, std::size_t thread = any_thread(), bool continue_search = false, bool exact = false) const { return search_(vector, wanted, thread, exact, casts_.from_f32, continue_search); }
-    search_result_t search(f64_t const* vector, std::size_t wanted, std::size_t thread = any_thread(), bool continue_search = false, bool exact = false) const { return search_(vector, wanted, thread, exact, casts_.from_f64, continue_search); }
+    /// Replaces the vector of an existing entry in place, found by its `key`, unless its `slot` is given explicitly
+    add_result_t update(vector_key_t key, b1x8_t const* vector, std::size_t thread = any_thread(), bool force_vector_copy = true, compressed_slot_t slot = default_free_value<compressed_slot_t>()) { return update_(key, vector, thread, force_vector_copy, casts_.from_b1x8, slot); }
+    add_result_t update(vector_key_t key, i8_t const* vector, std::size_t thread = any_thread(), bool force_vector_copy = true,   compressed_slot_t slot = default_free_value<compressed_slot_t>()) { return update_(key, vector, thread, force_vector_copy, casts_.from_i8, slot); }
+    add_result_t update(vector_key_t key, f16_t const* vector, std::size_t thread = any_thread(), bool force_vector_copy = true,  compressed_slot_t slot = default_free_value<compressed_slot_t>()) { return update_(key, vector, thread, force_vector_copy, casts_.from_f16, slot); }
+    add_result_t update(vector_key_t key, f32_t const* vector, std::size_t thread = any_thread(), bool force_vector_copy = true,  compressed_slot_t slot = default_free_value<compressed_slot_t>()) { return update_(key, vector, thread, force_vector_copy, casts_.from_f32, slot); }
+    add_result_t update(vector_key_t key, f64_t const* vector, std::size_t thread = any_thread(), bool force_vector_copy = true,  compressed_slot_t slot = default_free_value<compressed_slot_t>()) { return update_(key, vector, thread, force_vector_copy, casts_.from_f64, slot); }
+
+    add_result_t add_many(vector_key_t const* keys, b1x8_t const* vectors, std::size_t count, std::size_t thread = any_thread()) { return add_many_(keys, vectors, count, thread, casts_.from_b1x8); }
+    add_result_t add_many(vector_key_t const* keys, i8_t const* vectors, std::size_t count, std::size_t thread = any_thread()) { return add_many_(keys, vectors, count, thread, casts_.from_i8); }
+    add_result_t add_many(vector_key_t const* keys, f16_t const* vectors, std::size_t count, std::size_t thread = any_thread()) { return add_many_(keys, vectors, count, thread, casts_.from_f16); }
+    add_result_t add_many(vector_key_t const* keys, f32_t const* vectors, std::size_t count, std::size_t thread = any_thread()) { return add_many_(keys, vectors, count, thread, casts_.from_f32); }
+    add_result_t add_many(vector_key_t const* keys, f64_t const* vectors, std::size_t count, std::size_t thread = any_thread()) { return add_many_(keys, vectors, count, thread, casts_.from_f64); }
+
+    template <typename executor_at, typename progress_at = dummy_progress_t> add_result_t add_many(vector_key_t const* keys, b1x8_t const* vectors, std::size_t count, std::size_t stride, executor_at&& executor, progress_at&& progress = progress_at{}) { return add_many_(keys, vectors, count, stride, casts_.from_b1x8, executor, progress); }
+    template <typename executor_at, typename progress_at = dummy_progress_t> add_result_t add_many(vector_key_t const* keys, i8_t const* vectors, std::size_t count, std::size_t stride, executor_at&& executor, progress_at&& progress = progress_at{}) { return add_many_(keys, vectors, count, stride, casts_.from_i8, executor, progress); }
+    template <typename executor_at, typename progress_at = dummy_progress_t> add_result_t add_many(vector_key_t const* keys, f16_t const* vectors, std::size_t count, std::size_t stride, executor_at&& executor, progress_at&& progress = progress_at{}) { return add_many_(keys, vectors, count, stride, casts_.from_f16, executor, progress); }
+    template <typename executor_at, typename progress_at = dummy_progress_t> add_result_t add_many(vector_key_t const* keys, f32_t const* vectors, std::size_t count, std::size_t stride, executor_at&& executor, progress_at&& progress = progress_at{}) { return add_many_(keys, vectors, count, stride, casts_.from_f32, executor, progress); }
+    template <typename executor_at, typename progress_at = dummy_progress_t> add_result_t add_many(vector_key_t const* keys, f64_t const* vectors, std::size_t count, std::size_t stride, executor_at&& executor, progress_at&& progress = progress_at{}) { return add_many_(keys, vectors, count, stride, casts_.from_f64, executor, progress); }
+
+    search_result_t search(b1x8_t const* vector, std::size_t wanted, std::size_t thread = any_thread(), bool exact = false) const { return search_(vector, wanted, thread, search_config_(exact), casts_.from_b1x8); }
+    search_result_t search(i8_t const* vector, std::size_t wanted, std::size_t thread = any_thread(), bool exact = false) const { return search_(vector, wanted, thread, search_config_(exact), casts_.from_i8); }
+    search_result_t search(f16_t const* vector, std::size_t wanted, std::size_t thread = any_thread(), bool exact = false) const { return search_(vector, wanted, thread, search_config_(exact), casts_.from_f16); }
+    search_result_t search(f32_t const* vector, std::size_t wanted, std::size_t thread = any_thread(), bool exact = false) const { return search_(vector, wanted, thread, search_config_(exact), casts_.from_f32); }
+    search_result_t search(f64_t const* vector, std::size_t wanted, std::size_t thread = any_thread(), bool exact = false) const { return search_(vector, wanted, thread, search_config_(exact), casts_.from_f64); }
+
+    search_result_t search(b1x8_t const* vector, std::size_t wanted, index_search_config_t config, std::size_t thread = any_thread()) const { return search_(vector, wanted, thread, config, casts_.from_b1x8); }
+    search_result_t search(i8_t const* vector, std::size_t wanted, index_search_config_t config, std::size_t thread = any_thread()) const { return search_(vector, wanted, thread, config, casts_.from_i8); }
+    search_result_t search(f16_t const* vector, std::size_t wanted, index_search_config_t config, std::size_t thread = any_thread()) const { return search_(vector, wanted, thread, config, casts_.from_f16); }
+    search_result_t search(f32_t const* vector, std::size_t wanted, index_search_config_t config, std::size_t thread = any_thread()) const { return search_(vector, wanted, thread, config, casts_.from_f32); }
+    search_result_t search(f64_t const* vector, std::size_t wanted, index_search_config_t config, std::size_t thread = any_thread()) const { return search_(vector, wanted, thread, config, casts_.from_f64); }
+
+    template <typename predicate_at> search_result_t filtered_search(b1x8_t const* vector, std::size_t wanted, predicate_at&& predicate, index_search_config_t config = {}, std::size_t thread = any_thread()) const { return filtered_search_(vector, wanted, predicate, thread, config, casts_.from_b1x8); }
+    template <typename predicate_at> search_result_t filtered_search(i8_t const* vector, std::size_t wanted, predicate_at&& predicate, index_search_config_t config = {}, std::size_t thread = any_thread()) const { return filtered_search_(vector, wanted, predicate, thread, config, casts_.from_i8); }
+    template <typename predicate_at> search_result_t filtered_search(f16_t const* vector, std::size_t wanted, predicate_at&& predicate, index_search_config_t config = {}, std::size_t thread = any_thread()) const { return filtered_search_(vector, wanted, predicate, thread, config, casts_.from_f16); }
+    template <typename predicate_at> search_result_t filtered_search(f32_t const* vector, std::size_t wanted, predicate_at&& predicate, index_search_config_t config = {}, std::size_t thread = any_thread()) const { return filtered_search_(vector, wanted, predicate, thread, config, casts_.from_f32); }
+    template <typename predicate_at> search_result_t filtered_search(f64_t const* vector, std::size_t wanted, predicate_at&& predicate, index_search_config_t config = {}, std::size_t thread = any_thread()) const { return filtered_search_(vector, wanted, predicate, thread, config, casts_.from_f64); }
+
+    search_result_t search_range(b1x8_t const* vector, distance_t radius, std::size_t limit, index_search_config_t config = {}, std::size_t thread = any_thread()) const { return search_range_(vector, radius, limit, thread, config, casts_.from_b1x8); }
+    search_result_t search_range(i8_t const* vector, distance_t radius, std::size_t limit, index_search_config_t config = {}, std::size_t thread = any_thread()) const { return search_range_(vector, radius, limit, thread, config, casts_.from_i8); }
+    search_result_t search_range(f16_t const* vector, distance_t radius, std::size_t limit, index_search_config_t config = {}, std::size_t thread = any_thread()) const { return search_range_(vector, radius, limit, thread, config, casts_.from_f16); }
+    search_result_t search_range(f32_t const* vector, distance_t radius, std::size_t limit, index_search_config_t config = {}, std::size_t thread = any_thread()) const { return search_range_(vector, radius, limit, thread, config, casts_.from_f32); }
+    search_result_t search_range(f64_t const* vector, distance_t radius, std::size_t limit, index_search_config_t config = {}, std::size_t thread = any_thread()) const { return search_range_(vector, radius, limit, thread, config, casts_.from_f64); }
+
+    search_cursor_t search_cursor(b1x8_t const* vector, index_search_config_t config = {}) const { return search_cursor_(vector, config, casts_.from_b1x8); }
+    search_cursor_t search_cursor(i8_t const* vector, index_search_config_t config = {}) const { return search_cursor_(vector, config, casts_.from_i8); }
+    search_cursor_t search_cursor(f16_t const* vector, index_search_config_t config = {}) const { return search_cursor_(vector, config, casts_.from_f16); }
+    search_cursor_t search_cursor(f32_t const* vector, index_search_config_t config = {}) const { return search_cursor_(vector, config, casts_.from_f32); }
+    search_cursor_t search_cursor(f64_t const* vector, index_search_config_t config = {}) const { return search_cursor_(vector, config, casts_.from_f64); }
+
+    search_batch_result_t search_many(b1x8_t const* queries, std::size_t count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, std::size_t thread = any_thread()) const { return search_many_(queries, count, wanted, keys, distances, counts, thread, search_config_(false), casts_.from_b1x8); }
+    search_batch_result_t search_many(i8_t const* queries, std::size_t count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, std::size_t thread = any_thread()) const { return search_many_(queries, count, wanted, keys, distances, counts, thread, search_config_(false), casts_.from_i8); }
+    search_batch_result_t search_many(f16_t const* queries, std::size_t count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, std::size_t thread = any_thread()) const { return search_many_(queries, count, wanted, keys, distances, counts, thread, search_config_(false), casts_.from_f16); }
+    search_batch_result_t search_many(f32_t const* queries, std::size_t count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, std::size_t thread = any_thread()) const { return search_many_(queries, count, wanted, keys, distances, counts, thread, search_config_(false), casts_.from_f32); }
+    search_batch_result_t search_many(f64_t const* queries, std::size_t count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, std::size_t thread = any_thread()) const { return search_many_(queries, count, wanted, keys, distances, counts, thread, search_config_(false), casts_.from_f64); }
+
+    search_batch_result_t search_many(b1x8_t const* queries, std::size_t count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, index_search_config_t config, std::size_t thread = any_thread()) const { return search_many_(queries, count, wanted, keys, distances, counts, thread, config, casts_.from_b1x8); }
+    search_batch_result_t search_many(i8_t const* queries, std::size_t count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, index_search_config_t config, std::size_t thread = any_thread()) const { return search_many_(queries, count, wanted, keys, distances, counts, thread, config, casts_.from_i8); }
+    search_batch_result_t search_many(f16_t const* queries, std::size_t count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, index_search_config_t config, std::size_t thread = any_thread()) const { return search_many_(queries, count, wanted, keys, distances, counts, thread, config, casts_.from_f16); }
+    search_batch_result_t search_many(f32_t const* queries, std::size_t count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, index_search_config_t config, std::size_t thread = any_thread()) const { return search_many_(queries, count, wanted, keys, distances, counts, thread, config, casts_.from_f32); }
+    search_batch_result_t search_many(f64_t const* queries, std::size_t count, std::size_t wanted, vector_key_t* keys, distance_t* distances, std::size_t* counts, index_search_config_t config, std::size_t thread = any_thread()) const { return search_many_(queries, count, wanted, keys, distances, counts, thread, config, casts_.from_f64); }
 
     std::size_t get(vector_key_t key, b1x8_t* vector, std::size_t vectors_count = 1) const { return get_(key, vector, vectors_count, casts_.to_b1x8); }
     std::size_t get(vector_key_t key, i8_t* vector, std::size_t vectors_count = 1) const { return get_(key, vector, vectors_count, casts_.to_i8); }
@@ -658,6 +905,48 @@ class index_dense_gt {
     aggregated_distances_t distance_between(vector_key_t key, f64_t const* vector, std::size_t thread = any_thread()) const { return distance_between_(key, vector, thread, casts_.to_f64); }
     // clang-format on
 
+    /**
+     *  @brief  Yields up to ::wanted next closest matches of the ::cursor, passing the optional ::predicate.
+     *          The ::predicate must stay the same for all the calls on the same ::cursor.
+     *  @return Smart object referencing the memory of the ::cursor. Valid until its next use.
+     */
+    template <typename predicate_at = dummy_predicate_t>
+    search_result_t search_next(search_cursor_t& cursor, std::size_t wanted, predicate_at&& predicate = predicate_at{},
+                                std::size_t thread = any_thread()) const {
+
+        if (!cursor)
+            return search_result_t{}.failed("Cursor has no query!");
+
+        thread_lock_t lock = thread_lock_(thread);
+        index_search_config_t search_config = cursor.config_;
+        search_config.thread = lock.thread_id;
+
+        auto allow = [&](member_cref_t const& member) noexcept {
+            return member.key != free_key_ && predicate(member);
+        };
+        float const* lookup_table = cursor.lookup_table_ ? cursor.lookup_table_.data() : nullptr;
+        byte_t const* query = cursor.query_.data();
+        return typed_->search_next(cursor.traversal_, query, wanted,
+                                   metric_proxy_t{*this, lock.thread_id, lookup_table}, search_config, allow,
+                                   prefetch_proxy_t{storage_});
+    }
+
+    /**
+     *  @brief  Re-scores the results of a previous `search` against full-precision vectors, keeping the
+     *          ::wanted closest. Quantized storage only keeps vector codes and searches by approximate distances,
+     *          so callers holding the original vectors can ask `search` for more results and refine them here.
+     *
+     *  @param[in] query The query vector, already in the scalar type of the index metric.
+     *  @param[in] raw_vector Callable returning a pointer to the original vector of a key, in the same scalar type.
+     *  @return The number of results left.
+     */
+    template <typename raw_vector_at>
+    std::size_t rerank(search_result_t& result, byte_t const* query, std::size_t wanted,
+                       raw_vector_at&& raw_vector) const {
+        return result.rerank(
+            [&](member_cref_t member) noexcept { return metric_(query, raw_vector(get_key(member))); }, wanted);
+    }
+
     /**
      *  @brief  Computes the distance between two managed entities.
      *          If either key maps into more than one vector, will aggregate results
@@ -761,7 +1050,23 @@ class index_dense_gt {
      *  @brief Reserves memory for the index and the keyed lookup.
      *  @return `true` if the memory reservation was successful, `false` otherwise.
      */
-    bool reserve(index_limits_t limits) { return typed_->reserve(limits); }
+    /**
+     *  @brief Reserves memory for members and per-thread contexts. Growing the number of threads past
+     *  the one passed to `make()` lets more callers search and insert concurrently, rather than wait.
+     *  Like any other reservation, must not be called concurrently with other operations.
+     */
+    bool reserve(index_limits_t limits) {
+        std::size_t threads = (std::max)(limits.threads(), available_threads_.size());
+        limits.threads_add = limits.threads_search = threads;
+        if (!typed_->reserve(limits))
+            return false;
+
+        std::size_t bytes_per_vector = metric_.bytes_per_vector();
+        cast_buffer_.resize(threads * bytes_per_vector);
+        vector_decompress_buffer_.resize(threads * bytes_per_vector * 2);
+        lookup_tables_buffer_.resize(threads * storage_.lookup_table_size());
+        return available_threads_.reserve(threads);
+    }
 
     /**
      *  @brief Erases all the vectors from the index.
@@ -777,6 +1082,7 @@ class index_dense_gt {
         typed_->clear();
         slot_lookup_.clear();
         free_keys_.clear();
+        removed_slots_.clear();
     }
 
     /**
@@ -790,14 +1096,14 @@ class index_dense_gt {
         unique_lock_t lookup_lock(slot_lookup_mutex_);
 
         std::unique_lock<std::mutex> free_lock(free_keys_mutex_);
-        std::unique_lock<std::mutex> available_threads_lock(available_threads_mutex_);
         // storage is reset by typed_
         typed_->reset();
         slot_lookup_.clear();
         free_keys_.clear();
+        removed_slots_.clear();
 
         // Reset the thread IDs.
-        std::iota(available_threads_.begin(), available_threads_.end(), 0ul);
+        available_threads_.reset();
     }
 
     /**
@@ -834,11 +1140,20 @@ class index_dense_gt {
             head.multi = multi();
         }
 
+        // Compute the order of the nodes in the file, before anything is written
+        typename index_t::reorder_result_t order;
+        if (config.reorder) {
+            order = typed_->locality_order();
+            if (!order)
+                return result.failed(order.error.release());
+        }
+
         // save vectors and metadata to storage
         storage_.save_vectors_to_stream(output, metric_.bytes_per_vector(), typed_->size(), buffer, config);
 
         // Save the actual proximity graph
-        return typed_->save_to_stream(std::forward<output_callback_at>(output), std::forward<progress_at>(progress));
+        return typed_->save_to_stream(std::forward<output_callback_at>(output), std::forward<progress_at>(progress),
+                                      config.reorder ? &order.permutation : nullptr);
     }
 
     /**
@@ -851,7 +1166,8 @@ class index_dense_gt {
             dimensions_length = config.use_64_bit_dimensions ? sizeof(std::uint64_t) * 2 : sizeof(std::uint32_t) * 2;
             matrix_length = typed_->size() * metric_.bytes_per_vector();
         }
-        return dimensions_length + matrix_length + sizeof(index_dense_head_buffer_t) + typed_->serialized_length();
+        return dimensions_length + matrix_length + sizeof(index_dense_head_buffer_t) + typed_->serialized_length() +
+               storage_.serialized_overhead(typed_->size(), config.exclude_vectors);
     }
 
     /**
@@ -871,7 +1187,9 @@ class index_dense_gt {
         // Infer the new index size
         serialization_result_t result;
         index_dense_head_buffer_t buffer;
-        storage_.load_vectors_from_stream(input, buffer, config);
+        result = storage_.load_vectors_from_stream(input, buffer, config);
+        if (!result)
+            return result;
 
         // Load metadata and choose the right metric
         {
@@ -889,7 +1207,7 @@ class index_dense_gt {
             if (head.kind_compressed_slot != unum::usearch::scalar_kind<compressed_slot_t>())
                 return result.failed("Slot type doesn't match, consider rebuilding");
 
-            metric_ = metric_t(head.dimensions, head.kind_metric, head.kind_scalar);
+            change_metric(metric_t(head.dimensions, head.kind_metric, head.kind_scalar));
             config_.multi = head.multi;
         }
 
@@ -898,6 +1216,11 @@ class index_dense_gt {
         if (!result)
             return result;
 
+        // The graph reserves contexts for the default number of threads, which may be fewer than ours
+        if (!reserve(index_limits_t(typed_->limits().members, available_threads_.size())))
+            return result.failed("Out of memory");
+        // The storage may have switched to product quantization, if the file contained a codebook
+        lookup_tables_buffer_.resize(available_threads_.size() * storage_.lookup_table_size());
         // reindex_keys_();
         return result;
     }
@@ -937,7 +1260,7 @@ class index_dense_gt {
             if (head.kind_compressed_slot != unum::usearch::scalar_kind<compressed_slot_t>())
                 return result.failed("Slot type doesn't match, consider rebuilding");
 
-            metric_ = metric_t(head.dimensions, head.kind_metric, head.kind_scalar);
+            change_metric(metric_t(head.dimensions, head.kind_metric, head.kind_scalar));
             config_.multi = head.multi;
         }
 
@@ -946,6 +1269,10 @@ class index_dense_gt {
         if (!result)
             return result;
 
+        // The graph reserves contexts for the default number of threads, which may be fewer than ours
+        if (!reserve(index_limits_t(typed_->limits().members, available_threads_.size())))
+            return result.failed("Out of memory");
+        lookup_tables_buffer_.resize(available_threads_.size() * storage_.lookup_table_size());
         reindex_keys_();
         return result;
     }
@@ -973,6 +1300,10 @@ class index_dense_gt {
         typed_->set_node_retriever(retriever_ctx, node_retriever, node_retriever_mut);
     }
 
+    void set_node_retriever_batch(node_retriever_batch_t node_retriever_batch) {
+        typed_->set_node_retriever_batch(node_retriever_batch);
+    }
+
     typename storage_t::storage_metadata storage_metadata() { return typed_->storage_metadata(); }
 
     /**
@@ -1126,77 +1457,69 @@ class index_dense_gt {
      *          If the key was not found in the index, `result.completed` will be `false`.
      *          If an error occurred during the removal operation, `result.error` will contain an error message.
      */
-    labeling_result_t remove(vector_key_t key) {
-        labeling_result_t result;
-
-        unique_lock_t lookup_lock(slot_lookup_mutex_);
-        auto matching_slots = slot_lookup_.equal_range(key_and_slot_t::any_slot(key));
-        if (matching_slots.first == matching_slots.second)
-            return result;
-
-        // Grow the removed entries ring, if needed
-        std::size_t matching_count = std::distance(matching_slots.first, matching_slots.second);
-        std::unique_lock<std::mutex> free_lock(free_keys_mutex_);
-        if (!free_keys_.reserve(free_keys_.size() + matching_count))
-            return result.failed("Can't allocate memory for a free-list");
-
-        // A removed entry would be:
-        // - present in `free_keys_`
-        // - missing in the `slot_lookup_`
-        // - marked in the `typed_` index with a `free_key_`
-        for (auto slots_it = matching_slots.first; slots_it != matching_slots.second; ++slots_it) {
-            compressed_slot_t slot = (*slots_it).slot;
-            free_keys_.push(slot);
-            typed_->at(slot).key = free_key_;
-        }
-        slot_lookup_.erase(key);
-        result.completed = matching_count;
-
-        return result;
-    }
+    labeling_result_t remove(vector_key_t key) { return remove(&key, &key + 1); }
 
     /**
      *  @brief Removes multiple entries with the specified keys from the index.
+     *
+     *  Removed entries are skipped by searches right away, but are unlinked from the graph only
+     *  once they make up 1/`repair_ratio_k` of all the slots, or on `isolate`, as repairing takes a pass
+     *  over the whole graph. Then every entry pointing to them is reconnected to their neighbors,
+     *  so the search quality doesn't degrade with deletions, and their slots are reused by the following insertions.
+     *
      *  @param[in] keys_begin The beginning of the keys range.
      *  @param[in] keys_end The ending of the keys range.
+     *  @param executor The executor parallel processing. Default ::dummy_executor_t single-threaded.
+     *  @param progress The progress tracker instance to use. Default ::dummy_progress_t reports nothing.
      *  @return The ::labeling_result_t indicating the result of the removal operation.
      *          `result.completed` will contain the number of keys that were successfully removed.
      *          `result.error` will contain an error message if an error occurred during the removal operation.
      */
-    template <typename keys_iterator_at>
-    labeling_result_t remove(keys_iterator_at keys_begin, keys_iterator_at keys_end) {
+    template <typename keys_iterator_at, typename executor_at = dummy_executor_t,
+              typename progress_at = dummy_progress_t>
+    labeling_result_t remove(keys_iterator_at keys_begin, keys_iterator_at keys_end,
+                             executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}) {
 
         labeling_result_t result;
-        unique_lock_t lookup_lock(slot_lookup_mutex_);
-        std::unique_lock<std::mutex> free_lock(free_keys_mutex_);
-        // Grow the removed entries ring, if needed
-        std::size_t matching_count = 0;
-        for (auto keys_it = keys_begin; keys_it != keys_end; ++keys_it)
-            matching_count += slot_lookup_.count(key_and_slot_t::any_slot(*keys_it));
 
-        if (!free_keys_.reserve(free_keys_.size() + matching_count))
-            return result.failed("Can't allocate memory for a free-list");
+        // A removed entry would be:
+        // - missing in the `slot_lookup_`
+        // - marked in the `typed_` index with a `free_key_`
+        // - present in `removed_slots_`, until it's unlinked by `isolate`
+        // - present in `free_keys_` afterwards
+        bool repair = false;
+        {
+            unique_lock_t lookup_lock(slot_lookup_mutex_);
+            std::size_t matching_count = 0;
+            for (auto keys_it = keys_begin; keys_it != keys_end; ++keys_it)
+                matching_count += slot_lookup_.count(key_and_slot_t::any_slot(*keys_it));
+            if (!matching_count)
+                return result;
 
-        // Remove them one-by-one
-        for (auto keys_it = keys_begin; keys_it != keys_end; ++keys_it) {
-            vector_key_t key = *keys_it;
-            auto matching_slots = slot_lookup_.equal_range(key_and_slot_t::any_slot(key));
-            // A removed entry would be:
-            // - present in `free_keys_`
-            // - missing in the `slot_lookup_`
-            // - marked in the `typed_` index with a `free_key_`
-            matching_count = 0;
-            for (auto slots_it = matching_slots.first; slots_it != matching_slots.second; ++slots_it) {
-                compressed_slot_t slot = (*slots_it).slot;
-                free_keys_.push(slot);
-                typed_->at(slot).key = free_key_;
-                ++matching_count;
+            std::unique_lock<std::mutex> free_lock(free_keys_mutex_);
+            if (!removed_slots_.reserve(removed_slots_.size() + matching_count))
+                return result.failed("Can't allocate memory for a free-list");
+
+            for (auto keys_it = keys_begin; keys_it != keys_end; ++keys_it) {
+                vector_key_t key = *keys_it;
+                auto matching_slots = slot_lookup_.equal_range(key_and_slot_t::any_slot(key));
+                for (auto slots_it = matching_slots.first; slots_it != matching_slots.second; ++slots_it) {
+                    compressed_slot_t slot = (*slots_it).slot;
+                    removed_slots_.push(slot);
+                    typed_->at(slot).key = free_key_;
+                }
+                slot_lookup_.erase(key);
             }
-
-            slot_lookup_.erase(key);
-            result.completed += matching_count;
+            result.completed = matching_count;
+            repair = removed_slots_.size() * repair_ratio_k >= typed_->size();
         }
 
+        if (repair) {
+            compaction_result_t repaired =
+                isolate(std::forward<executor_at>(executor), std::forward<progress_at>(progress));
+            if (!repaired)
+                return result.failed(std::move(repaired.error));
+        }
         return result;
     }
 
@@ -1282,6 +1605,10 @@ class index_dense_gt {
             return result.failed(std::move(typed_result.error));
         for (std::size_t i = 0; i != free_keys_.size(); ++i)
             copy.free_keys_.push(free_keys_[i]);
+        if (!copy.removed_slots_.reserve(removed_slots_.size()))
+            return result.failed("Out of memory!");
+        for (std::size_t i = 0; i != removed_slots_.size(); ++i)
+            copy.removed_slots_.push(removed_slots_[i]);
 
         // Allocate buffers and move the vectors themselves
         // if (!config.force_vector_copy && copy.config_.exclude_vectors)
@@ -1314,9 +1641,10 @@ class index_dense_gt {
         other.config_ = config_;
         other.cast_buffer_ = cast_buffer_;
         other.vector_decompress_buffer_ = vector_decompress_buffer_;
+        other.lookup_tables_buffer_ = lookup_tables_buffer_;
         other.casts_ = casts_;
 
-        other.metric_ = metric_;
+        other.change_metric(metric_);
         other.available_threads_ = available_threads_;
         other.free_key_ = free_key_;
 
@@ -1342,7 +1670,8 @@ class index_dense_gt {
     };
 
     /**
-     *  @brief Performs compaction on the index, pruning links to removed entries.
+     *  @brief Performs compaction on the index, pruning links to removed entries
+     *         and reconnecting their former neighbors to each other, so their slots can be reused.
      *  @param executor The executor parallel processing. Default ::dummy_executor_t single-threaded.
      *  @param progress The progress tracker instance to use. Default ::dummy_progress_t reports nothing.
      *  @return The ::compaction_result_t indicating the result of the compaction operation.
@@ -1351,15 +1680,62 @@ class index_dense_gt {
      */
     template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
     compaction_result_t isolate(executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}) {
-        compaction_result_t result;
-        std::atomic<std::size_t> pruned_edges;
-        auto disallow = [&](member_cref_t const& member) noexcept {
-            bool freed = member.key == free_key_;
-            pruned_edges += freed;
-            return freed;
+
+        // Entries removed during the pass may be missed by it, so only the earlier ones are freed
+        std::unique_lock<std::mutex> isolate_lock(isolate_mutex_);
+        std::size_t removed_count = 0;
+        {
+            std::unique_lock<std::mutex> free_lock(free_keys_mutex_);
+            removed_count = removed_slots_.size();
+        }
+
+        // Until the links are repaired, searches may still pass through the removed entries,
+        // so their slots can't be handed out to new entries yet
+        compaction_result_t result =
+            repair_(std::forward<executor_at>(executor), std::forward<progress_at>(progress));
+        if (!result)
+            return result;
+
+        std::unique_lock<std::mutex> free_lock(free_keys_mutex_);
+        if (!free_keys_.reserve(free_keys_.size() + removed_count))
+            return result.failed("Can't allocate memory for a free-list");
+        compressed_slot_t slot;
+        for (std::size_t i = 0; i != removed_count && removed_slots_.try_pop(slot); ++i)
+            free_keys_.push(slot);
+        return result;
+    }
+
+    /**
+     *  @brief Renumbers the slots in a locality-preserving order, so that the neighbors of every entry
+     *         are stored nearby, and the files it is saved to get the same layout.
+     *         Must not run concurrently with any other operation.
+     *  @param executor The executor parallel processing. Default ::dummy_executor_t single-threaded.
+     *  @param progress The progress tracker instance to use. Default ::dummy_progress_t reports nothing.
+     *  @return The ::compaction_result_t indicating the result of the operation.
+     *  @see `index_gt::locality_order` for the order, and `serialization_config_t::reorder` to only reorder the file.
+     */
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
+    compaction_result_t reorder(executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}) {
+
+        // The traversal and the relabeling are reported as two halves of the job
+        // Relabeling the slots loses track of the removed entries, that are still linked
+        compaction_result_t result = isolate(executor);
+        if (!result)
+            return result;
+        auto order_progress = [&](std::size_t passed, std::size_t total) { return progress(passed, 2 * total); };
+        auto relabel_progress = [&](std::size_t passed, std::size_t total) {
+            return progress(total + passed, 2 * total);
         };
-        typed_->isolate(disallow, std::forward<executor_at>(executor), std::forward<progress_at>(progress));
-        result.pruned_edges = pruned_edges;
+
+        typename index_t::reorder_result_t order = typed_->locality_order(order_progress);
+        if (!order)
+            return result.failed(order.error.release());
+        typename index_t::reorder_result_t reordered =
+            typed_->reorder(order.permutation, std::forward<executor_at>(executor), relabel_progress);
+        if (!reordered)
+            return result.failed(reordered.error.release());
+
+        reindex_keys_();
         return result;
     }
 
@@ -1379,18 +1755,10 @@ class index_dense_gt {
         if (thread_id != any_thread())
             return {*this, thread_id, false};
 
-        available_threads_mutex_.lock();
-        thread_id = available_threads_.back();
-        available_threads_.pop_back();
-        available_threads_mutex_.unlock();
-        return {*this, thread_id, true};
+        return {*this, available_threads_.acquire(), true};
     }
 
-    void thread_unlock_(std::size_t thread_id) const {
-        available_threads_mutex_.lock();
-        available_threads_.push_back(thread_id);
-        available_threads_mutex_.unlock();
-    }
+    void thread_unlock_(std::size_t thread_id) const { available_threads_.release(thread_id); }
 
     template <typename scalar_at>
     add_result_t add_(                             //
@@ -1409,45 +1777,548 @@ class index_dense_gt {
                 vector_data = casted_data, copy_vector = true;
         }
 
-        // Perform the insertion or the update
-        bool reuse_node = false;
+        return add_casted_(key, vector_data, copy_vector, lock.thread_id, level, slot);
+    }
+
+    /**
+     *  @brief  Inserts a vector, already casted to the scalar type of `metric_`.
+     *  @param[in] encoded_data Optional copy of the vector already encoded by `storage_t::encode_vectors`.
+     */
+    add_result_t add_casted_(                                          //
+        vector_key_t key, byte_t const* vector_data, bool copy_vector, //
+        std::size_t thread, level_t level, compressed_slot_t slot,     //
+        byte_t const* encoded_data = nullptr) {
+
+        // Check if there are some removed entries, whose nodes we can reuse,
+        // unless the caller manages the slots on its own
+        compressed_slot_t free_slot = default_free_value<compressed_slot_t>();
+        if (slot == default_free_value<compressed_slot_t>()) {
+            std::unique_lock<std::mutex> lock(free_keys_mutex_);
+            free_keys_.try_pop(free_slot);
+        }
+        if (free_slot != default_free_value<compressed_slot_t>())
+            return update_casted_(key, vector_data, copy_vector, thread, free_slot, true, encoded_data);
+
+        auto on_success = [&](member_ref_t member) {
+            if (config_.enable_key_lookups) {
+                unique_lock_t slot_lock(slot_lookup_mutex_);
+                slot_lookup_.try_emplace(key_and_slot_t{key, static_cast<compressed_slot_t>(member.slot)});
+            }
+            if (encoded_data)
+                storage_.set_vector_at(member.slot, encoded_data, storage_.encoded_vector_bytes(), true, false, true);
+            else
+                storage_.set_vector_at(member.slot, vector_data, metric_.bytes_per_vector(), copy_vector, false, false);
+        };
+
+        index_update_config_t update_config;
+        update_config.thread = thread;
+        update_config.expansion = config_.expansion_add;
+
+        return visit_metric_([&](auto const& metric) {
+            using proxy_t = metric_proxy_gt<typename std::decay<decltype(metric)>::type>;
+            return typed_->add(key, level, slot, vector_data, proxy_t{*this, thread, nullptr, metric}, update_config,
+                               on_success, prefetch_proxy_t{storage_});
+        });
+    }
+
+    /**
+     *  @brief  Overwrites the vector in an existing @p slot, already casted to the scalar type of `metric_`,
+     *          and relinks its node across all of its levels.
+     *  @param[in] new_key Whether the slot is reused for a different key, that must be registered for lookups.
+     */
+    add_result_t update_casted_(                                       //
+        vector_key_t key, byte_t const* vector_data, bool copy_vector, //
+        std::size_t thread, compressed_slot_t slot, bool new_key,      //
+        byte_t const* encoded_data = nullptr) {
+
+        // Without a copy the old vector may have been viewed, rather than allocated
+        bool reuse_vector = !config_.exclude_vectors;
 
         auto on_success = [&](member_ref_t member) {
-            storage_.set_vector_at(member.slot, vector_data, metric_.bytes_per_vector(), copy_vector, reuse_node);
+            if (new_key && config_.enable_key_lookups) {
+                unique_lock_t slot_lock(slot_lookup_mutex_);
+                slot_lookup_.try_emplace(key_and_slot_t{key, static_cast<compressed_slot_t>(member.slot)});
+            }
+            if (encoded_data)
+                storage_.set_vector_at(member.slot, encoded_data, storage_.encoded_vector_bytes(), true, reuse_vector,
+                                       true);
+            else
+                storage_.set_vector_at(member.slot, vector_data, metric_.bytes_per_vector(), copy_vector,
+                                       reuse_vector && copy_vector, false);
         };
 
         index_update_config_t update_config;
-        update_config.thread = lock.thread_id;
+        update_config.thread = thread;
         update_config.expansion = config_.expansion_add;
 
-        metric_proxy_t metric{*this, lock.thread_id};
-        usearch_assert_m(!reuse_node, "Updates not supported with Lantern");
-        return typed_->add(key, level, slot, vector_data, metric, update_config, on_success);
+        metric_proxy_t metric{*this, thread};
+        return typed_->update(typed_->iterator_at(slot), key, vector_data, metric, update_config, on_success,
+                              prefetch_proxy_t{storage_});
     }
 
     template <typename scalar_at>
-    search_result_t search_(                         //
-        scalar_at const* vector, std::size_t wanted, //
-        std::size_t thread, bool exact, cast_t const& cast, bool continue_search = false) const {
+    add_result_t update_(                          //
+        vector_key_t key, scalar_at const* vector, //
+        std::size_t thread, bool force_vector_copy, cast_t const& cast, compressed_slot_t slot) {
+
+        add_result_t result;
+        if (typed_->is_immutable())
+            return result.failed("Can't update an immutable index");
+
+        // Find the matching slot, unless the caller manages the slots on its own
+        if (slot == default_free_value<compressed_slot_t>()) {
+            shared_lock_t slots_lock(slot_lookup_mutex_);
+            auto key_range = slot_lookup_.equal_range(key_and_slot_t::any_slot(key));
+            if (key_range.first == key_range.second)
+                return result.failed("Key missing!");
+            if (std::distance(key_range.first, key_range.second) > 1)
+                return result.failed("Can't update a key with multiple vectors");
+            slot = (*key_range.first).slot;
+        }
 
         // Cast the vector, if needed for compatibility with `metric_`
         thread_lock_t lock = thread_lock_(thread);
+        bool copy_vector = !config_.exclude_vectors || force_vector_copy;
         byte_t const* vector_data = reinterpret_cast<byte_t const*>(vector);
         {
             byte_t* casted_data = cast_buffer_.data() + metric_.bytes_per_vector() * lock.thread_id;
             bool casted = cast(vector_data, dimensions(), casted_data);
             if (casted)
-                vector_data = casted_data;
+                vector_data = casted_data, copy_vector = true;
+        }
+
+        return update_casted_(key, vector_data, copy_vector, lock.thread_id, slot, false);
+    }
+
+    /**
+     *  @brief  Casts, encodes and inserts up to `add_many_batch_k` vectors, spaced @p stride bytes apart,
+     *          using the @p casted and @p encoded scratch buffers sized for a whole batch.
+     */
+    add_result_t add_batch_(                                                      //
+        vector_key_t const* keys, byte_t const* vectors, std::size_t count,       //
+        std::size_t stride, std::size_t thread, cast_t const& cast,               //
+        byte_t* casted_batch, byte_t* encoded_batch) {
+
+        add_result_t result;
+        std::size_t const bytes_per_vector = metric_.bytes_per_vector();
+        std::size_t const bytes_per_encoded = storage_.encoded_vector_bytes();
+
+        // Vectors are casted and encoded together, so that the storage can encode a whole batch at once
+        bool casted = false;
+        for (std::size_t i = 0; i != count; ++i)
+            casted = cast(vectors + i * stride, dimensions(), casted_batch + i * bytes_per_vector);
+        if (casted)
+            vectors = casted_batch, stride = bytes_per_vector;
+        if (bytes_per_encoded)
+            storage_.encode_vectors(vectors, count, stride, encoded_batch);
+
+        bool copy_vector = !config_.exclude_vectors || casted;
+        for (std::size_t i = 0; i != count; ++i) {
+            byte_t const* encoded_data = bytes_per_encoded ? encoded_batch + i * bytes_per_encoded : nullptr;
+            add_result_t added = add_casted_(keys[i], vectors + i * stride, copy_vector, thread, -1,
+                                             default_free_value<compressed_slot_t>(), encoded_data);
+            if (!added)
+                return added;
+            result.new_size = added.new_size;
+            result.visited_members += added.visited_members;
+            result.computed_distances += added.computed_distances;
+        }
+        return result;
+    }
+
+    template <typename scalar_at>
+    add_result_t add_many_(                                                     //
+        vector_key_t const* keys, scalar_at const* vectors, std::size_t count, //
+        std::size_t thread, cast_t const& cast) {
+
+        thread_lock_t lock = thread_lock_(thread);
+        add_result_t result;
+        std::size_t const bytes_per_input =
+            divide_round_up<CHAR_BIT>(dimensions() * bits_per_scalar(usearch::scalar_kind<scalar_at>()));
+        std::size_t const batch_size = (std::min<std::size_t>)(add_many_batch_k, count);
+        buffer_gt<byte_t> casted_batch(batch_size * metric_.bytes_per_vector());
+        buffer_gt<byte_t> encoded_batch(batch_size * storage_.encoded_vector_bytes());
+        if (!casted_batch || (storage_.encoded_vector_bytes() && !encoded_batch))
+            return result.failed("Out of memory!");
+
+        for (std::size_t batch_start = 0; batch_start < count; batch_start += batch_size) {
+            add_result_t added = add_batch_(keys + batch_start,
+                                            reinterpret_cast<byte_t const*>(vectors) + batch_start * bytes_per_input,
+                                            (std::min)(batch_size, count - batch_start), bytes_per_input,
+                                            lock.thread_id, cast, casted_batch.data(), encoded_batch.data());
+            if (!added)
+                return added;
+            result.new_size = added.new_size;
+            result.visited_members += added.visited_members;
+            result.computed_distances += added.computed_distances;
+        }
+        return result;
+    }
+
+    /**
+     *  Reserves the capacity for all the @p count vectors and enough thread contexts for the @p executor
+     *  once, then inserts batches of `add_many_batch_k` vectors in parallel. Every batch locks its own
+     *  thread context, so the indices of the executor threads don't have to match the contexts.
+     *  Just like `reserve`, must not be called concurrently with other operations on the index.
+     */
+    template <typename scalar_at, typename executor_at, typename progress_at>
+    add_result_t add_many_(                                                     //
+        vector_key_t const* keys, scalar_at const* vectors, std::size_t count, //
+        std::size_t stride, cast_t const& cast, executor_at&& executor, progress_at&& progress) {
+
+        add_result_t result;
+        std::size_t const bytes_per_input =
+            divide_round_up<CHAR_BIT>(dimensions() * bits_per_scalar(usearch::scalar_kind<scalar_at>()));
+        if (!stride)
+            stride = bytes_per_input;
+
+        std::size_t const threads = (std::max)(executor.size(), available_threads_.size());
+        if (typed_->size() + count > capacity() || threads > available_threads_.size())
+            if (!reserve(index_limits_t((std::max)(capacity(), typed_->size() + count), threads)))
+                return result.failed("Out of memory!");
+
+        // Every thread context gets its own scratch space for casted and encoded batches
+        std::size_t const contexts = available_threads_.size();
+        std::size_t const batch_size = (std::min<std::size_t>)(add_many_batch_k, count);
+        std::size_t const casted_bytes = batch_size * metric_.bytes_per_vector();
+        std::size_t const encoded_bytes = batch_size * storage_.encoded_vector_bytes();
+        buffer_gt<byte_t> casted_batches(contexts * casted_bytes);
+        buffer_gt<byte_t> encoded_batches(contexts * encoded_bytes);
+        if (!casted_batches || (encoded_bytes && !encoded_batches))
+            return result.failed("Out of memory!");
+
+        std::size_t const batches = batch_size ? divide_round_up(count, batch_size) : 0;
+        std::atomic<std::size_t> processed{0};
+        std::atomic<std::size_t> visited_members{0};
+        std::atomic<std::size_t> computed_distances{0};
+        std::atomic<char const*> atomic_error{nullptr};
+        executor.dynamic(batches, [&](std::size_t thread_idx, std::size_t batch_idx) {
+            std::size_t const batch_start = batch_idx * batch_size;
+            std::size_t const batch_count = (std::min)(batch_size, count - batch_start);
+            thread_lock_t lock = thread_lock_(any_thread());
+            add_result_t added = add_batch_(keys + batch_start,
+                                            reinterpret_cast<byte_t const*>(vectors) + batch_start * stride,
+                                            batch_count, stride, lock.thread_id, cast,
+                                            casted_batches.data() + lock.thread_id * casted_bytes,
+                                            encoded_batches.data() + lock.thread_id * encoded_bytes);
+            if (!added) {
+                atomic_error = added.error.release();
+                return false;
+            }
+            visited_members += added.visited_members;
+            computed_distances += added.computed_distances;
+
+            // It's more efficient in this case to report progress from a single thread
+            processed += batch_count;
+            if (thread_idx == 0 && !progress(processed.load(), count)) {
+                atomic_error = "Terminated by user";
+                return false;
+            }
+            return true;
+        });
+
+        result.new_size = size();
+        result.visited_members = visited_members;
+        result.computed_distances = computed_distances;
+        if (char const* error = atomic_error.load())
+            return result.failed(error);
+
+        // At the end report the latest numbers, because the reporter thread may be finished earlier
+        progress(processed.load(), count);
+        return result;
+    }
+
+    /**
+     *  Unlinks the entries marked with a `free_key_` from the rest of the graph, in parallel,
+     *  and moves the entry point away from them. Every node locks its own thread context,
+     *  so the indices of the executor threads don't have to match the contexts.
+     */
+    template <typename executor_at, typename progress_at>
+    compaction_result_t repair_(executor_at&& executor, progress_at&& progress) {
+
+        compaction_result_t result;
+        std::size_t const threads = executor.size();
+        if (threads > available_threads_.size())
+            if (!reserve(index_limits_t(capacity(), threads)))
+                return result.failed("Out of memory!");
+
+        auto disallow = [&](member_cref_t const& member) noexcept { return member.key == free_key_; };
+        std::size_t const count = typed_->size();
+        std::atomic<std::size_t> processed{0};
+        std::atomic<std::size_t> pruned_edges{0};
+        std::atomic<char const*> atomic_error{nullptr};
+        executor.dynamic(count, [&](std::size_t thread_idx, std::size_t slot) {
+            thread_lock_t lock = thread_lock_(any_thread());
+            index_update_config_t update_config;
+            update_config.thread = lock.thread_id;
+            metric_proxy_t metric{*this, lock.thread_id};
+            auto repaired = typed_->repair(typed_->iterator_at(slot), metric, disallow, update_config);
+            if (!repaired) {
+                atomic_error = repaired.error.release();
+                return false;
+            }
+            pruned_edges += repaired.pruned_edges;
+
+            // It's more efficient in this case to report progress from a single thread
+            processed += 1;
+            if (thread_idx == 0 && !progress(processed.load(), count)) {
+                atomic_error = "Terminated by user";
+                return false;
+            }
+            return true;
+        });
+
+        result.pruned_edges = pruned_edges;
+        if (char const* error = atomic_error.load())
+            return result.failed(error);
+
+        typed_->repair_entry(disallow);
+        progress(processed.load(), count);
+        return result;
+    }
+
+    /// The number of dimensions, for which the built-in single-precision metrics are specialized at compile time
+    static std::size_t fixed_dimensions_of_(metric_t const& metric) noexcept {
+        if (!USEARCH_USE_FIXED_METRICS || !metric.builtin() || metric.scalar_kind() != scalar_kind_t::f32_k)
+            return 0;
+        switch (metric.metric_kind()) {
+        case metric_kind_t::l2sq_k:
+        case metric_kind_t::ip_k:
+        case metric_kind_t::cos_k: break;
+        default: return 0;
+        }
+        switch (metric.dimensions()) {
+        case 128:
+        case 384:
+        case 768:
+        case 1536: return metric.dimensions();
+        default: return 0;
+        }
+    }
+
+    /**
+     *  @brief  Calls @p callback with a metric, specialized at compile time for the kind and dimensions of `metric_`,
+     *          if there is one, or with `metric_` itself. The choice is made once per call, rather than per distance,
+     *          so the kernels get inlined into the traversal loops of `index_gt`, instantiated for every metric.
+     */
+    template <typename callback_at> auto visit_metric_(callback_at&& callback) const {
+#if USEARCH_USE_FIXED_METRICS
+        switch (fixed_dimensions_ ? metric_.metric_kind() : metric_kind_t::unknown_k) {
+        case metric_kind_t::l2sq_k: return visit_dimensions_<metric_kind_t::l2sq_k>(callback);
+        case metric_kind_t::ip_k: return visit_dimensions_<metric_kind_t::ip_k>(callback);
+        case metric_kind_t::cos_k: return visit_dimensions_<metric_kind_t::cos_k>(callback);
+        default: return callback(metric_);
         }
+#else
+        return callback(metric_);
+#endif
+    }
 
+    template <metric_kind_t metric_ak, typename callback_at> auto visit_dimensions_(callback_at&& callback) const {
+        switch (fixed_dimensions_) {
+        case 128: return callback(metric_fixed_f32_gt<metric_ak, 128>{});
+        case 384: return callback(metric_fixed_f32_gt<metric_ak, 384>{});
+        case 768: return callback(metric_fixed_f32_gt<metric_ak, 768>{});
+        case 1536: return callback(metric_fixed_f32_gt<metric_ak, 1536>{});
+        default: return callback(metric_);
+        }
+    }
+
+    /// Per-call search config, equivalent to the index-wide settings
+    index_search_config_t search_config_(bool exact) const noexcept {
         index_search_config_t search_config;
-        search_config.thread = lock.thread_id;
         search_config.expansion = config_.expansion_search;
         search_config.exact = exact;
+        return search_config;
+    }
+
+    /**
+     *  Unlike the rest of the config, the `thread` of @p search_config is ignored in favor of @p thread,
+     *  as it must match the locked context, and the zero `expansion` defaults to `expansion_search()`.
+     */
+    template <typename scalar_at>
+    search_result_t search_(                                                   //
+        scalar_at const* vector, std::size_t wanted, std::size_t thread,       //
+        index_search_config_t search_config, cast_t const& cast) const {
+
+        thread_lock_t lock = thread_lock_(thread);
+        float* lookup_table = nullptr;
+        byte_t const* vector_data = prepare_query_(vector, lock.thread_id, cast, lookup_table);
+
+        search_config.thread = lock.thread_id;
+        if (!search_config.expansion)
+            search_config.expansion = config_.expansion_search;
 
         auto allow = [=](member_cref_t const& member) noexcept { return member.key != free_key_; };
-        return typed_->search(vector_data, wanted, metric_proxy_t{*this, lock.thread_id}, search_config, allow,
-                              dummy_prefetch_t{}, continue_search);
+        return visit_metric_([&](auto const& metric) {
+            using proxy_t = metric_proxy_gt<typename std::decay<decltype(metric)>::type>;
+            return typed_->search(vector_data, wanted, proxy_t{*this, lock.thread_id, lookup_table, metric},
+                                  search_config, allow, prefetch_proxy_t{storage_});
+        });
+    }
+
+    /**
+     *  Same as `search_`, but adapts to the selectivity of the @p predicate, that is tested
+     *  on the `member_cref_t` of every candidate, as described in `index_gt::filtered_search`.
+     */
+    template <typename scalar_at, typename predicate_at>
+    search_result_t filtered_search_(                                          //
+        scalar_at const* vector, std::size_t wanted, predicate_at&& predicate, //
+        std::size_t thread, index_search_config_t search_config, cast_t const& cast) const {
+
+        thread_lock_t lock = thread_lock_(thread);
+        float* lookup_table = nullptr;
+        byte_t const* vector_data = prepare_query_(vector, lock.thread_id, cast, lookup_table);
+
+        search_config.thread = lock.thread_id;
+        if (!search_config.expansion)
+            search_config.expansion = config_.expansion_search;
+
+        auto allow = [&](member_cref_t const& member) noexcept {
+            return member.key != free_key_ && predicate(member);
+        };
+        return typed_->filtered_search(vector_data, wanted, metric_proxy_t{*this, lock.thread_id, lookup_table}, allow,
+                                       search_config, prefetch_proxy_t{storage_});
+    }
+
+    /**
+     *  Same as `search_`, but returns up to @p limit closest entries within the @p radius,
+     *  however many there are, as described in `index_gt::search_range`.
+     */
+    template <typename scalar_at>
+    search_result_t search_range_(                                                         //
+        scalar_at const* vector, distance_t radius, std::size_t limit, std::size_t thread, //
+        index_search_config_t search_config, cast_t const& cast) const {
+
+        thread_lock_t lock = thread_lock_(thread);
+        float* lookup_table = nullptr;
+        byte_t const* vector_data = prepare_query_(vector, lock.thread_id, cast, lookup_table);
+
+        search_config.thread = lock.thread_id;
+        if (!search_config.expansion)
+            search_config.expansion = config_.expansion_search;
+
+        auto allow = [=](member_cref_t const& member) noexcept { return member.key != free_key_; };
+        return typed_->search_range(vector_data, radius, limit, metric_proxy_t{*this, lock.thread_id, lookup_table},
+                                    search_config, allow, prefetch_proxy_t{storage_});
+    }
+
+    /**
+     *  Copies the casted @p vector and its lookup table into a new cursor, that doesn't depend on
+     *  the buffers of any thread. Zero `expansion` of @p search_config defaults to `expansion_search()`.
+     */
+    template <typename scalar_at>
+    search_cursor_t search_cursor_(scalar_at const* vector, index_search_config_t search_config,
+                                   cast_t const& cast) const {
+
+        search_cursor_t cursor;
+        std::size_t const bytes_per_vector = metric_.bytes_per_vector();
+        std::size_t const lookup_table_size = storage_.lookup_table_size();
+        buffer_gt<byte_t> query(bytes_per_vector);
+        buffer_gt<float> lookup_table(lookup_table_size);
+        if (!query || (lookup_table_size && !lookup_table))
+            return cursor;
+
+        byte_t const* vector_data = reinterpret_cast<byte_t const*>(vector);
+        if (!cast(vector_data, dimensions(), query.data()))
+            std::memcpy(query.data(), vector_data, bytes_per_vector);
+
+        // Quantized vectors are compared to the query through a lookup table, built once per query
+        if (lookup_table_size && storage_.lookup_table(query.data(), metric_.metric_kind(), lookup_table.data()))
+            cursor.lookup_table_ = std::move(lookup_table);
+
+        if (!search_config.expansion)
+            search_config.expansion = config_.expansion_search;
+        cursor.query_ = std::move(query);
+        cursor.config_ = search_config;
+        return cursor;
+    }
+
+    /**
+     *  Casts the query @p vector into the buffer of the @p thread_id, if needed for compatibility with `metric_`,
+     *  and builds its @p lookup_table, if the vectors are quantized. Returns the casted query.
+     */
+    template <typename scalar_at>
+    byte_t const* prepare_query_(scalar_at const* vector, std::size_t thread_id, cast_t const& cast,
+                                 float*& lookup_table) const {
+
+        byte_t const* vector_data = reinterpret_cast<byte_t const*>(vector);
+        byte_t* casted_data = cast_buffer_.data() + metric_.bytes_per_vector() * thread_id;
+        if (cast(vector_data, dimensions(), casted_data))
+            vector_data = casted_data;
+
+        // Quantized vectors are compared to the query through a lookup table, built once per query
+        lookup_table = nullptr;
+        std::size_t lookup_table_size = storage_.lookup_table_size();
+        if (lookup_table_size && lookup_tables_buffer_.size() >= lookup_table_size * (thread_id + 1)) {
+            lookup_table = lookup_tables_buffer_.data() + lookup_table_size * thread_id;
+            if (!storage_.lookup_table(vector_data, metric_.metric_kind(), lookup_table))
+                lookup_table = nullptr;
+        }
+        return vector_data;
+    }
+
+    /**
+     *  Searches @p count queries, writing up to @p wanted results of the i-th query into the i-th row of
+     *  @p keys and @p distances, and their number into `counts[i]`. Queries are casted and traversed in
+     *  batches of `search_many_batch_k`, sharing the fetches of the upper-level nodes.
+     */
+    template <typename scalar_at>
+    search_batch_result_t search_many_(                                                      //
+        scalar_at const* queries, std::size_t count, std::size_t wanted,                     //
+        vector_key_t* keys, distance_t* distances, std::size_t* counts, std::size_t thread, //
+        index_search_config_t search_config, cast_t const& cast) const {
+
+        thread_lock_t lock = thread_lock_(thread);
+        search_batch_result_t result;
+        std::size_t const bytes_per_input =
+            divide_round_up<CHAR_BIT>(dimensions() * bits_per_scalar(usearch::scalar_kind<scalar_at>()));
+        std::size_t const bytes_per_vector = metric_.bytes_per_vector();
+        std::size_t const lookup_table_size = storage_.lookup_table_size();
+
+        search_config.thread = lock.thread_id;
+        if (!search_config.expansion)
+            search_config.expansion = config_.expansion_search;
+
+        std::size_t const batch_size = (std::min<std::size_t>)(search_many_batch_k, count);
+        buffer_gt<byte_t> casted_batch(batch_size * bytes_per_vector);
+        buffer_gt<float> lookup_tables(batch_size * lookup_table_size);
+        buffer_gt<query_t> batch_queries(batch_size);
+        if (!casted_batch || (lookup_table_size && !lookup_tables) || !batch_queries)
+            return result.failed("Out of memory!");
+
+        auto allow = [=](member_cref_t const& member) noexcept { return member.key != free_key_; };
+        metric_proxy_t metric{*this, lock.thread_id};
+        for (std::size_t batch_start = 0; batch_start < count; batch_start += batch_size) {
+            std::size_t const batch_count = (std::min)(batch_size, count - batch_start);
+            byte_t const* batch_data = reinterpret_cast<byte_t const*>(queries) + batch_start * bytes_per_input;
+            for (std::size_t i = 0; i != batch_count; ++i) {
+                query_t& query = batch_queries[i];
+                query.vector = batch_data + i * bytes_per_input;
+                query.lookup_table = nullptr;
+                byte_t* casted_data = casted_batch.data() + i * bytes_per_vector;
+                if (cast(query.vector, dimensions(), casted_data))
+                    query.vector = casted_data;
+
+                // Quantized vectors are compared to the query through a lookup table, built once per query
+                float* lookup_table = lookup_tables.data() + i * lookup_table_size;
+                if (lookup_table_size && storage_.lookup_table(query.vector, metric_.metric_kind(), lookup_table))
+                    query.lookup_table = lookup_table;
+            }
+
+            auto on_result = [&](std::size_t i, search_result_t& found) noexcept {
+                std::size_t const query_idx = batch_start + i;
+                counts[query_idx] = found.dump_to(keys + query_idx * wanted, distances + query_idx * wanted);
+            };
+            search_batch_result_t batch_result = typed_->search_batch( //
+                static_cast<query_t const*>(batch_queries.data()), batch_count, wanted, metric, search_config,
+                on_result, allow, prefetch_proxy_t{storage_});
+            if (!batch_result)
+                return batch_result;
+            result.visited_members += batch_result.visited_members;
+            result.computed_distances += batch_result.computed_distances;
+        }
+        return result;
     }
 
     template <typename scalar_at>
@@ -1540,6 +2411,7 @@ class index_dense_gt {
             slot_lookup_.reserve(count_total - count_removed);
         free_keys_.clear();
         free_keys_.reserve(count_removed);
+        removed_slots_.clear();
         for (std::size_t i = 0; i != typed_->size(); ++i) {
             member_cref_t member = typed_->at(i);
             if (member.key == free_key_)
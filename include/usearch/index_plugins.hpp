@@ -3,16 +3,39 @@
 #include <float.h>  // `_Float16`
 #include <stdlib.h> // `aligned_alloc`
 
-#include <cstring> // `std::strncmp`
-#include <numeric> // `std::iota`
-#include <thread>  // `std::thread`
-#include <vector>  // `std::vector`
+#include <condition_variable> // `std::condition_variable`
+#include <cstring>            // `std::strncmp`
+#include <exception>          // `std::exception_ptr`
+#include <memory>             // `std::unique_ptr`
+#include <mutex>              // `std::mutex`
+#include <numeric>            // `std::iota`
+#include <thread>             // `std::thread`
+#include <vector>             // `std::vector`
 
 #include <atomic> // `std::atomic`
 #include <thread> // `std::thread`
 
 #include <usearch/index.hpp> // `expected_gt` and macros
 
+// Hand-written kernels, picked at runtime, rely on the `target` attribute of GCC and Clang on x86
+#if !defined(USEARCH_USE_NATIVE_KERNELS)
+#if defined(USEARCH_DEFINED_X86) && (defined(USEARCH_DEFINED_GCC) || defined(USEARCH_DEFINED_CLANG))
+#define USEARCH_USE_NATIVE_KERNELS 1
+#elif defined(USEARCH_DEFINED_ARM) && defined(__ARM_NEON)
+#define USEARCH_USE_NATIVE_KERNELS 1
+#else
+#define USEARCH_USE_NATIVE_KERNELS 0
+#endif
+#endif
+
+#if defined(__AVX2__) || defined(__AVX512F__) || (USEARCH_USE_NATIVE_KERNELS && defined(USEARCH_DEFINED_X86))
+#include <immintrin.h> // `_mm512_load_ps`
+#endif
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h> // `vfmaq_f32`
+#endif
+
 #if !defined(USEARCH_USE_OPENMP)
 #define USEARCH_USE_OPENMP 0
 #endif
@@ -492,6 +515,267 @@ class executor_stl_t {
     }
 };
 
+/**
+ *  @brief  A persistent work-stealing "thread-pool" for parallel execution.
+ *          The worker threads are shared by all the instances and outlive every call, so unlike
+ *          `executor_stl_t`, small batches don't pay for thread creation.
+ *
+ *  Every call splits the tasks into contiguous ranges, one per participating thread. The owner
+ *  consumes its range from the front in small chunks, and the threads that run out of work steal
+ *  halves of other ranges from the back. The calling thread always participates as thread zero,
+ *  so the call completes even if all the workers are busy serving other callers.
+ */
+class executor_pool_t {
+    std::size_t threads_count_{};
+
+    /// @brief Minimum number of chunks every thread splits its share of tasks into.
+    static constexpr std::size_t chunks_per_thread_k = 16;
+
+    /// @brief Task indices range, consumed from the front by the owner and stolen from the back.
+    struct alignas(64) range_t {
+        std::atomic_flag lock = ATOMIC_FLAG_INIT;
+        std::size_t begin{};
+        std::size_t end{};
+
+        void lock_() noexcept {
+            while (lock.test_and_set(std::memory_order_acquire))
+                std::this_thread::yield();
+        }
+        void unlock_() noexcept { lock.clear(std::memory_order_release); }
+    };
+
+    /// @brief A single call to `fixed`, `dynamic` or `parallel`, shared by all its participants.
+    struct job_t {
+        using trampoline_t = bool (*)(void*, std::size_t, std::size_t);
+
+        void* function{};
+        trampoline_t trampoline{};
+        std::size_t chunk{};
+        std::size_t participants{};
+        std::unique_ptr<range_t[]> ranges;
+        std::atomic<bool> stop{false};
+
+        // Guarded by the mutex of the shared pool.
+        std::size_t next_participant = 1;
+        std::size_t active_helpers = 0;
+        std::exception_ptr error;
+
+        bool pop(std::size_t participant, std::size_t& first, std::size_t& last) noexcept {
+            range_t& own = ranges[participant];
+            own.lock_();
+            first = own.begin;
+            last = (std::min)(own.end, own.begin + chunk);
+            own.begin = last;
+            own.unlock_();
+            return first != last;
+        }
+
+        bool steal(std::size_t participant) noexcept {
+            for (std::size_t offset = 1; offset != participants; ++offset) {
+                range_t& victim = ranges[(participant + offset) % participants];
+                victim.lock_();
+                std::size_t remaining = victim.end - victim.begin;
+                std::size_t stolen_end = victim.end;
+                victim.end -= (remaining + 1) / 2;
+                std::size_t stolen_begin = victim.end;
+                victim.unlock_();
+                if (stolen_begin == stolen_end)
+                    continue;
+
+                range_t& own = ranges[participant];
+                own.lock_();
+                own.begin = stolen_begin;
+                own.end = stolen_end;
+                own.unlock_();
+                return true;
+            }
+            return false;
+        }
+
+        void run(std::size_t participant, std::mutex& mutex) noexcept {
+            try {
+                std::size_t first, last;
+                while (!stop.load(std::memory_order_relaxed)) {
+                    if (!pop(participant, first, last)) {
+                        if (!steal(participant))
+                            break;
+                        continue;
+                    }
+                    for (std::size_t task_idx = first; task_idx != last && !stop.load(std::memory_order_relaxed);
+                         ++task_idx)
+                        if (!trampoline(function, participant, task_idx))
+                            stop.store(true, std::memory_order_relaxed);
+                }
+            } catch (...) {
+                stop.store(true, std::memory_order_relaxed);
+                std::unique_lock<std::mutex> lock(mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+    };
+
+    /// @brief Process-wide set of workers, lazily grown to the largest requested number of threads.
+    struct pool_t {
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+        std::vector<std::thread> workers;
+        std::vector<job_t*> jobs;
+        bool shutdown = false;
+
+        ~pool_t() {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                shutdown = true;
+            }
+            wake.notify_all();
+            for (std::thread& worker : workers)
+                worker.join();
+        }
+
+        void grow(std::size_t count) noexcept(false) {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (workers.size() < count)
+                workers.emplace_back([this]() { serve(); });
+        }
+
+        void serve() noexcept {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                wake.wait(lock, [&]() { return shutdown || !jobs.empty(); });
+                if (shutdown)
+                    return;
+
+                job_t& job = *jobs.front();
+                std::size_t participant = job.next_participant++;
+                if (job.next_participant == job.participants)
+                    jobs.erase(jobs.begin());
+                ++job.active_helpers;
+                lock.unlock();
+                job.run(participant, mutex);
+                lock.lock();
+                if (--job.active_helpers == 0)
+                    done.notify_all();
+            }
+        }
+
+        void execute(job_t& job) noexcept(false) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                jobs.push_back(&job);
+            }
+            for (std::size_t helper = 1; helper != job.participants; ++helper)
+                wake.notify_one();
+            job.run(0, mutex);
+
+            // Revoke the tickets no worker has claimed, and wait for the ones that did.
+            std::unique_lock<std::mutex> lock(mutex);
+            auto it = std::find(jobs.begin(), jobs.end(), &job);
+            if (it != jobs.end())
+                jobs.erase(it);
+            done.wait(lock, [&]() { return job.active_helpers == 0; });
+            if (job.error)
+                std::rethrow_exception(job.error);
+        }
+    };
+
+    static pool_t& pool() noexcept {
+        static pool_t shared;
+        return shared;
+    }
+
+    template <typename function_at>
+    static bool trampoline_(void* function, std::size_t thread_idx, std::size_t task_idx) noexcept(false) {
+        return (*reinterpret_cast<function_at*>(function))(thread_idx, task_idx);
+    }
+
+    template <typename function_at>
+    void execute_(std::size_t tasks, std::size_t chunk, function_at& function) noexcept(false) {
+        std::size_t participants = (std::min)(threads_count_, tasks);
+        if (participants <= 1) {
+            for (std::size_t task_idx = 0; task_idx != tasks; ++task_idx)
+                if (!function(0, task_idx))
+                    break;
+            return;
+        }
+
+        job_t job;
+        job.function = &function;
+        job.trampoline = &trampoline_<function_at>;
+        job.chunk = chunk ? chunk : (std::max<std::size_t>)(1, tasks / (participants * chunks_per_thread_k));
+        job.participants = participants;
+        job.ranges.reset(new range_t[participants]);
+        for (std::size_t participant = 0; participant != participants; ++participant) {
+            job.ranges[participant].begin = tasks * participant / participants;
+            job.ranges[participant].end = tasks * (participant + 1) / participants;
+        }
+
+        pool_t& shared = pool();
+        shared.grow(threads_count_ - 1);
+        shared.execute(job);
+    }
+
+  public:
+    /**
+     *  @param threads_count The number of threads to be used for parallel execution.
+     */
+    executor_pool_t(std::size_t threads_count = 0) noexcept
+        : threads_count_(threads_count ? threads_count : std::thread::hardware_concurrency()) {
+        threads_count_ = (std::max<std::size_t>)(threads_count_, 1);
+    }
+
+    /**
+     *  @return Maximum number of threads available to the executor.
+     */
+    std::size_t size() const noexcept { return threads_count_; }
+
+    /**
+     *  @brief Executes a fixed number of tasks using the specified thread-aware function.
+     *  @param tasks                 The total number of tasks to be executed.
+     *  @param thread_aware_function The thread-aware function to be called for each thread index and task index.
+     *  @throws If an exception occurs during execution of the thread-aware function.
+     */
+    template <typename thread_aware_function_at>
+    void fixed(std::size_t tasks, thread_aware_function_at&& thread_aware_function) noexcept(false) {
+        auto function = [&](std::size_t thread_idx, std::size_t task_idx) {
+            thread_aware_function(thread_idx, task_idx);
+            return true;
+        };
+        execute_(tasks, 0, function);
+    }
+
+    /**
+     *  @brief Executes limited number of tasks using the specified thread-aware function.
+     *         Stops scheduling new tasks once any of the calls returns `false`.
+     *  @param tasks                 The upper bound on the number of tasks.
+     *  @param thread_aware_function The thread-aware function to be called for each thread index and task index.
+     *  @throws If an exception occurs during execution of the thread-aware function.
+     */
+    template <typename thread_aware_function_at>
+    void dynamic(std::size_t tasks, thread_aware_function_at&& thread_aware_function) noexcept(false) {
+        auto function = [&](std::size_t thread_idx, std::size_t task_idx) -> bool {
+            return thread_aware_function(thread_idx, task_idx);
+        };
+        execute_(tasks, 0, function);
+    }
+
+    /**
+     *  @brief Saturates every available thread with the given workload, until they finish.
+     *         Every thread index is passed exactly once, but not necessarily to a separate thread.
+     *  @param thread_aware_function The thread-aware function to be called for each thread index.
+     *  @throws If an exception occurs during execution of the thread-aware function.
+     */
+    template <typename thread_aware_function_at>
+    void parallel(thread_aware_function_at&& thread_aware_function) noexcept(false) {
+        auto function = [&](std::size_t, std::size_t thread_idx) {
+            thread_aware_function(thread_idx);
+            return true;
+        };
+        execute_(threads_count_, 1, function);
+    }
+};
+
 #if USEARCH_USE_OPENMP
 
 /**
@@ -570,7 +854,7 @@ using executor_default_t = executor_openmp_t;
 
 #else
 
-using executor_default_t = executor_stl_t;
+using executor_default_t = executor_pool_t;
 
 #endif
 
@@ -617,6 +901,7 @@ using aligned_allocator_t = aligned_allocator_gt<>;
 class page_allocator_t {
   public:
     static constexpr std::size_t page_size() { return 4096; }
+    static constexpr std::size_t huge_page_size() { return 2 * 1024 * 1024; }
 
     /**
      *  @brief Allocates an @b uninitialized block of memory of the specified size.
@@ -628,7 +913,15 @@ class page_allocator_t {
 #if defined(USEARCH_DEFINED_WINDOWS)
         return (byte_t*)(::VirtualAlloc(NULL, count_bytes, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
 #else
-        return (byte_t*)mmap(NULL, count_bytes, PROT_WRITE | PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
+        void* pages = mmap(NULL, count_bytes, PROT_WRITE | PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
+        if (pages == MAP_FAILED)
+            return nullptr;
+#if defined(MADV_HUGEPAGE)
+        // Large arenas are worth backing with huge pages, to reduce TLB misses during graph traversals
+        if (count_bytes >= huge_page_size())
+            madvise(pages, count_bytes, MADV_HUGEPAGE);
+#endif
+        return (byte_t*)pages;
 #endif
     }
 
@@ -784,6 +1077,123 @@ template <std::size_t alignment_ak = 1> class memory_mapping_allocator_gt {
 
 using memory_mapping_allocator_t = memory_mapping_allocator_gt<>;
 
+/**
+ *  @brief  Slab allocator on top of `memory_mapping_allocator_gt`, for many small blocks of a few distinct sizes,
+ *          like graph nodes of different levels and their vectors. Blocks are carved out of large arenas,
+ *          so that consecutive allocations are adjacent in memory. Freed blocks are kept in per-size free lists
+ *          and reused by the following allocations of the same size, while `reset` releases all arenas at once.
+ *          @b Thread-safe, @b except constructors and destructors.
+ *
+ *  @tparam alignment_ak Alignment of every block, also making blocks of close sizes share a size class.
+ */
+template <std::size_t alignment_ak = 64> class slab_allocator_gt {
+
+    /// Number of distinct block sizes, which freed blocks are recycled for.
+    static constexpr std::size_t size_classes_k = 32;
+
+    memory_mapping_allocator_gt<alignment_ak> arenas_;
+    std::mutex free_lists_mutex_;
+    /// The size of blocks in every class, or zero for unused classes.
+    std::size_t class_sizes_[size_classes_k]{};
+    /// Heads of singly-linked lists of freed blocks, that store the pointer to the next block in their first bytes.
+    byte_t* free_lists_[size_classes_k]{};
+
+    static std::size_t block_size(std::size_t count_bytes) noexcept {
+        count_bytes = (std::max)(count_bytes, sizeof(byte_t*));
+        return divide_round_up<alignment_ak>(count_bytes) * alignment_ak;
+    }
+
+  public:
+    using value_type = byte_t;
+    using size_type = std::size_t;
+    using pointer = byte_t*;
+    using const_pointer = byte_t const*;
+
+    slab_allocator_gt() = default;
+    slab_allocator_gt(slab_allocator_gt&& other) noexcept : arenas_(std::move(other.arenas_)) {
+        std::memcpy(class_sizes_, other.class_sizes_, sizeof(class_sizes_));
+        std::memcpy(free_lists_, other.free_lists_, sizeof(free_lists_));
+        std::memset(other.class_sizes_, 0, sizeof(other.class_sizes_));
+        std::memset(other.free_lists_, 0, sizeof(other.free_lists_));
+    }
+
+    slab_allocator_gt& operator=(slab_allocator_gt&& other) noexcept {
+        std::swap(arenas_, other.arenas_);
+        std::swap(class_sizes_, other.class_sizes_);
+        std::swap(free_lists_, other.free_lists_);
+        return *this;
+    }
+
+    /**
+     *  @brief Copy constructor.
+     *  @note This is a no-op copy constructor since the allocator is not copyable.
+     */
+    slab_allocator_gt(slab_allocator_gt const&) noexcept {}
+
+    /**
+     *  @brief Copy assignment operator.
+     *  @note This is a no-op copy assignment operator since the allocator is not copyable.
+     */
+    slab_allocator_gt& operator=(slab_allocator_gt const&) noexcept {
+        reset();
+        return *this;
+    }
+
+    /**
+     *  @brief Discards all previously allocated memory blocks, releasing the arenas.
+     */
+    void reset() noexcept {
+        std::unique_lock<std::mutex> lock(free_lists_mutex_);
+        arenas_.reset();
+        std::memset(class_sizes_, 0, sizeof(class_sizes_));
+        std::memset(free_lists_, 0, sizeof(free_lists_));
+    }
+
+    /**
+     *  @brief Allocates an @b uninitialized block of memory, preferring a previously freed block of the same size.
+     *  @return A pointer to the allocated memory block, or `nullptr` if allocation fails.
+     */
+    byte_t* allocate(std::size_t count_bytes) noexcept {
+        std::size_t const size = block_size(count_bytes);
+        {
+            std::unique_lock<std::mutex> lock(free_lists_mutex_);
+            for (std::size_t i = 0; i != size_classes_k && class_sizes_[i]; ++i) {
+                if (class_sizes_[i] != size || !free_lists_[i])
+                    continue;
+                byte_t* block = free_lists_[i];
+                std::memcpy(&free_lists_[i], block, sizeof(byte_t*));
+                return block;
+            }
+        }
+        return arenas_.allocate(size);
+    }
+
+    /**
+     *  @brief Returns the block to the free list of its size, to be reused by the following allocations.
+     *          Blocks of sizes beyond the supported number of size classes are only released by `reset`.
+     */
+    void deallocate(byte_t* block, std::size_t count_bytes) noexcept {
+        if (!block)
+            return;
+        std::size_t const size = block_size(count_bytes);
+        std::unique_lock<std::mutex> lock(free_lists_mutex_);
+        for (std::size_t i = 0; i != size_classes_k; ++i) {
+            if (class_sizes_[i] && class_sizes_[i] != size)
+                continue;
+            class_sizes_[i] = size;
+            std::memcpy(block, &free_lists_[i], sizeof(byte_t*));
+            free_lists_[i] = block;
+            return;
+        }
+    }
+
+    /**
+     *  @brief Returns the amount of memory used by the allocator across all arenas.
+     *  @return The amount of space in bytes.
+     */
+    std::size_t total_allocated() const noexcept { return arenas_.total_allocated(); }
+};
+
 /**
  *  @brief  C++11 userspace implementation of an oversimplified `std::shared_mutex`,
  *          that assumes rare interleaving of shared and unique locks. It's not fair,
@@ -872,6 +1282,73 @@ template <typename mutex_at = unfair_shared_mutex_t> class shared_lock_gt {
     inline ~shared_lock_gt() noexcept { mutex_.unlock_shared(); }
 };
 
+/**
+ *  @brief  Lock-free pool of thread slots, identifying per-thread contexts and buffers.
+ *          Every slot is a busy flag on a separate cache line, acquired with a single CAS.
+ *
+ *  Threads first try the slot they held the last time, to find its context still warm in their
+ *  caches, and then probe the others. If all slots are busy, they back off until one is released.
+ *  Growing the pool isn't thread-safe, just like reserving the capacity of the index.
+ */
+class thread_slots_t {
+    struct alignas(64) slot_t {
+        std::atomic<bool> busy{false};
+    };
+    buffer_gt<slot_t> slots_;
+
+    /// @brief Number of failed probing rounds, after which the thread yields instead of spinning.
+    static constexpr std::size_t spins_k = 16;
+
+  public:
+    thread_slots_t() noexcept = default;
+    thread_slots_t(thread_slots_t&&) noexcept = default;
+    thread_slots_t& operator=(thread_slots_t&&) noexcept = default;
+    /// @brief Copies describe the same number of slots, all of them free.
+    thread_slots_t(thread_slots_t const& other) noexcept : slots_(other.size()) {}
+    thread_slots_t& operator=(thread_slots_t const& other) noexcept {
+        slots_ = buffer_gt<slot_t>(other.size());
+        return *this;
+    }
+
+    std::size_t size() const noexcept { return slots_.size(); }
+
+    /// @brief Grows the pool to at least @p count slots. Must not be called concurrently with anything else.
+    bool reserve(std::size_t count) noexcept {
+        if (count <= size())
+            return true;
+        buffer_gt<slot_t> new_slots(count);
+        if (!new_slots)
+            return false;
+        slots_ = std::move(new_slots);
+        return true;
+    }
+
+    /// @brief Marks all slots free. Must not be called concurrently with anything else.
+    void reset() noexcept {
+        for (slot_t& slot : slots_)
+            slot.busy.store(false, std::memory_order_relaxed);
+    }
+
+    /// @brief Acquires a free slot, waiting for one if all are busy. The pool must not be empty.
+    std::size_t acquire() noexcept {
+        static thread_local std::size_t hint = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        std::size_t const count = size();
+        for (std::size_t round = 0;; ++round) {
+            for (std::size_t i = 0; i != count; ++i) {
+                std::size_t slot = (hint + i) % count;
+                bool busy = slots_[slot].busy.load(std::memory_order_relaxed);
+                if (!busy && slots_[slot].busy.compare_exchange_strong( //
+                                 busy, true, std::memory_order_acquire, std::memory_order_relaxed))
+                    return hint = slot;
+            }
+            if (round >= spins_k)
+                std::this_thread::yield();
+        }
+    }
+
+    void release(std::size_t slot) noexcept { slots_[slot].busy.store(false, std::memory_order_release); }
+};
+
 /**
  *  @brief  Utility class used to cast arrays of one scalar type to another,
  *          avoiding unnecessary conversions.
@@ -1050,6 +1527,244 @@ template <typename scalar_at = float, typename result_at = scalar_at> struct met
     }
 };
 
+/**
+ *  @brief  Alignment of stored vectors, at which they can be fetched with aligned loads.
+ *          Matches the width of AVX-512 registers.
+ */
+constexpr std::size_t vector_alignment_k = 64;
+
+/**
+ *  @brief  Squared Euclidean, Inner Product, or Cosine distance between single-precision vectors,
+ *          where the second one is aligned to `vector_alignment_k` bytes. The first one, usually
+ *          the query, may be unaligned. Matches `::metric_l2sq_gt`, `::metric_ip_gt`, and
+ *          `::metric_cos_gt` up to the order of floating-point additions.
+ */
+template <metric_kind_t metric_ak> struct metric_aligned_f32_gt {
+    using scalar_t = f32_t;
+    using result_t = f32_t;
+
+    static_assert(metric_ak == metric_kind_t::l2sq_k || metric_ak == metric_kind_t::ip_k ||
+                      metric_ak == metric_kind_t::cos_k,
+                  "Only L2, IP, and Cosine metrics are supported");
+
+    inline result_t operator()(f32_t const* a, f32_t const* b, std::size_t dim) const noexcept {
+        std::size_t i = 0;
+        f32_t ab{}, a2{}, b2{}, ab_deltas_sq{};
+#if defined(__AVX512F__)
+        __m512 ab_vec = _mm512_setzero_ps(), a2_vec = ab_vec, b2_vec = ab_vec, ab_deltas_sq_vec = ab_vec;
+        std::size_t const body = dim - dim % 16;
+        for (; i != body; i += 16) {
+            __m512 a_vec = _mm512_loadu_ps(a + i);
+            __m512 b_vec = _mm512_load_ps(b + i);
+            if constexpr (metric_ak == metric_kind_t::l2sq_k) {
+                __m512 delta_vec = _mm512_sub_ps(a_vec, b_vec);
+                ab_deltas_sq_vec = _mm512_fmadd_ps(delta_vec, delta_vec, ab_deltas_sq_vec);
+            } else {
+                ab_vec = _mm512_fmadd_ps(a_vec, b_vec, ab_vec);
+            }
+            if constexpr (metric_ak == metric_kind_t::cos_k) {
+                a2_vec = _mm512_fmadd_ps(a_vec, a_vec, a2_vec);
+                b2_vec = _mm512_fmadd_ps(b_vec, b_vec, b2_vec);
+            }
+        }
+        ab = _mm512_reduce_add_ps(ab_vec), a2 = _mm512_reduce_add_ps(a2_vec), b2 = _mm512_reduce_add_ps(b2_vec);
+        ab_deltas_sq = _mm512_reduce_add_ps(ab_deltas_sq_vec);
+#elif defined(__AVX2__)
+        __m256 ab_vec = _mm256_setzero_ps(), a2_vec = ab_vec, b2_vec = ab_vec, ab_deltas_sq_vec = ab_vec;
+        std::size_t const body = dim - dim % 8;
+        for (; i != body; i += 8) {
+            __m256 a_vec = _mm256_loadu_ps(a + i);
+            __m256 b_vec = _mm256_load_ps(b + i);
+            if constexpr (metric_ak == metric_kind_t::l2sq_k) {
+                __m256 delta_vec = _mm256_sub_ps(a_vec, b_vec);
+                ab_deltas_sq_vec = _mm256_add_ps(ab_deltas_sq_vec, _mm256_mul_ps(delta_vec, delta_vec));
+            } else {
+                ab_vec = _mm256_add_ps(ab_vec, _mm256_mul_ps(a_vec, b_vec));
+            }
+            if constexpr (metric_ak == metric_kind_t::cos_k) {
+                a2_vec = _mm256_add_ps(a2_vec, _mm256_mul_ps(a_vec, a_vec));
+                b2_vec = _mm256_add_ps(b2_vec, _mm256_mul_ps(b_vec, b_vec));
+            }
+        }
+        ab = reduce_add_(ab_vec), a2 = reduce_add_(a2_vec), b2 = reduce_add_(b2_vec);
+        ab_deltas_sq = reduce_add_(ab_deltas_sq_vec);
+#endif
+        for (; i < dim; ++i) {
+            if constexpr (metric_ak == metric_kind_t::l2sq_k)
+                ab_deltas_sq += square(a[i] - b[i]);
+            else
+                ab += a[i] * b[i];
+            if constexpr (metric_ak == metric_kind_t::cos_k)
+                a2 += square(a[i]), b2 += square(b[i]);
+        }
+
+        if constexpr (metric_ak == metric_kind_t::l2sq_k)
+            return ab_deltas_sq;
+        else if constexpr (metric_ak == metric_kind_t::ip_k)
+            return 1 - ab;
+        else {
+            result_t result_if_zero[2][2];
+            result_if_zero[0][0] = 1 - ab / (std::sqrt(a2) * std::sqrt(b2));
+            result_if_zero[0][1] = result_if_zero[1][0] = 1;
+            result_if_zero[1][1] = 0;
+            return result_if_zero[a2 == 0][b2 == 0];
+        }
+    }
+
+  private:
+#if defined(__AVX2__) && !defined(__AVX512F__)
+    static f32_t reduce_add_(__m256 vec) noexcept {
+        __m128 half_vec = _mm_add_ps(_mm256_castps256_ps128(vec), _mm256_extractf128_ps(vec, 1));
+        half_vec = _mm_hadd_ps(half_vec, half_vec);
+        half_vec = _mm_hadd_ps(half_vec, half_vec);
+        return _mm_cvtss_f32(half_vec);
+    }
+#endif
+};
+
+/**
+ *  @brief  Squared Euclidean, Inner Product, or Cosine distances from one single-precision vector to many.
+ *          Every chunk of the first vector, usually the query, is loaded into registers once and compared
+ *          to a group of the other vectors, using independent accumulators, to keep the pipelines busy.
+ *          With AVX2 or AVX-512 the additions happen in the same order, as in `::metric_aligned_f32_gt`.
+ */
+template <metric_kind_t metric_ak> struct metric_batch_f32_gt {
+    using scalar_t = f32_t;
+    using result_t = f32_t;
+
+    static_assert(metric_ak == metric_kind_t::l2sq_k || metric_ak == metric_kind_t::ip_k ||
+                      metric_ak == metric_kind_t::cos_k,
+                  "Only L2, IP, and Cosine metrics are supported");
+
+    /// @brief  Number of vectors compared to every loaded chunk of the first one.
+    static constexpr std::size_t group_k = 4;
+
+    inline void operator()(f32_t const* a, f32_t const* const* bs, std::size_t count, std::size_t dim,
+                           result_t* results) const noexcept {
+        std::size_t j = 0;
+        for (; j + group_k <= count; j += group_k)
+            group_<group_k>(a, bs + j, dim, results + j);
+        for (; j != count; ++j)
+            group_<1>(a, bs + j, dim, results + j);
+    }
+
+  private:
+    template <std::size_t group_ak>
+    static void group_(f32_t const* a, f32_t const* const* bs, std::size_t dim, result_t* results) noexcept {
+        std::size_t i = 0;
+        f32_t ab[group_ak]{}, a2[group_ak]{}, b2[group_ak]{}, ab_deltas_sq[group_ak]{};
+#if defined(__AVX512F__)
+        __m512 ab_vec[group_ak], a2_vec[group_ak], b2_vec[group_ak], ab_deltas_sq_vec[group_ak];
+        for (std::size_t k = 0; k != group_ak; ++k)
+            ab_vec[k] = a2_vec[k] = b2_vec[k] = ab_deltas_sq_vec[k] = _mm512_setzero_ps();
+        std::size_t const body = dim - dim % 16;
+        for (; i != body; i += 16) {
+            __m512 a_vec = _mm512_loadu_ps(a + i);
+            for (std::size_t k = 0; k != group_ak; ++k) {
+                __m512 b_vec = _mm512_loadu_ps(bs[k] + i);
+                if constexpr (metric_ak == metric_kind_t::l2sq_k) {
+                    __m512 delta_vec = _mm512_sub_ps(a_vec, b_vec);
+                    ab_deltas_sq_vec[k] = _mm512_fmadd_ps(delta_vec, delta_vec, ab_deltas_sq_vec[k]);
+                } else {
+                    ab_vec[k] = _mm512_fmadd_ps(a_vec, b_vec, ab_vec[k]);
+                }
+                if constexpr (metric_ak == metric_kind_t::cos_k) {
+                    a2_vec[k] = _mm512_fmadd_ps(a_vec, a_vec, a2_vec[k]);
+                    b2_vec[k] = _mm512_fmadd_ps(b_vec, b_vec, b2_vec[k]);
+                }
+            }
+        }
+        for (std::size_t k = 0; k != group_ak; ++k) {
+            ab[k] = _mm512_reduce_add_ps(ab_vec[k]), a2[k] = _mm512_reduce_add_ps(a2_vec[k]);
+            b2[k] = _mm512_reduce_add_ps(b2_vec[k]), ab_deltas_sq[k] = _mm512_reduce_add_ps(ab_deltas_sq_vec[k]);
+        }
+#elif defined(__AVX2__)
+        __m256 ab_vec[group_ak], a2_vec[group_ak], b2_vec[group_ak], ab_deltas_sq_vec[group_ak];
+        for (std::size_t k = 0; k != group_ak; ++k)
+            ab_vec[k] = a2_vec[k] = b2_vec[k] = ab_deltas_sq_vec[k] = _mm256_setzero_ps();
+        std::size_t const body = dim - dim % 8;
+        for (; i != body; i += 8) {
+            __m256 a_vec = _mm256_loadu_ps(a + i);
+            for (std::size_t k = 0; k != group_ak; ++k) {
+                __m256 b_vec = _mm256_loadu_ps(bs[k] + i);
+                if constexpr (metric_ak == metric_kind_t::l2sq_k) {
+                    __m256 delta_vec = _mm256_sub_ps(a_vec, b_vec);
+                    ab_deltas_sq_vec[k] = _mm256_add_ps(ab_deltas_sq_vec[k], _mm256_mul_ps(delta_vec, delta_vec));
+                } else {
+                    ab_vec[k] = _mm256_add_ps(ab_vec[k], _mm256_mul_ps(a_vec, b_vec));
+                }
+                if constexpr (metric_ak == metric_kind_t::cos_k) {
+                    a2_vec[k] = _mm256_add_ps(a2_vec[k], _mm256_mul_ps(a_vec, a_vec));
+                    b2_vec[k] = _mm256_add_ps(b2_vec[k], _mm256_mul_ps(b_vec, b_vec));
+                }
+            }
+        }
+        for (std::size_t k = 0; k != group_ak; ++k) {
+            ab[k] = reduce_add_(ab_vec[k]), a2[k] = reduce_add_(a2_vec[k]), b2[k] = reduce_add_(b2_vec[k]);
+            ab_deltas_sq[k] = reduce_add_(ab_deltas_sq_vec[k]);
+        }
+#elif defined(__ARM_NEON)
+        float32x4_t ab_vec[group_ak], a2_vec[group_ak], b2_vec[group_ak], ab_deltas_sq_vec[group_ak];
+        for (std::size_t k = 0; k != group_ak; ++k)
+            ab_vec[k] = a2_vec[k] = b2_vec[k] = ab_deltas_sq_vec[k] = vdupq_n_f32(0);
+        std::size_t const body = dim - dim % 4;
+        for (; i != body; i += 4) {
+            float32x4_t a_vec = vld1q_f32(a + i);
+            for (std::size_t k = 0; k != group_ak; ++k) {
+                float32x4_t b_vec = vld1q_f32(bs[k] + i);
+                if constexpr (metric_ak == metric_kind_t::l2sq_k) {
+                    float32x4_t delta_vec = vsubq_f32(a_vec, b_vec);
+                    ab_deltas_sq_vec[k] = vfmaq_f32(ab_deltas_sq_vec[k], delta_vec, delta_vec);
+                } else {
+                    ab_vec[k] = vfmaq_f32(ab_vec[k], a_vec, b_vec);
+                }
+                if constexpr (metric_ak == metric_kind_t::cos_k) {
+                    a2_vec[k] = vfmaq_f32(a2_vec[k], a_vec, a_vec);
+                    b2_vec[k] = vfmaq_f32(b2_vec[k], b_vec, b_vec);
+                }
+            }
+        }
+        for (std::size_t k = 0; k != group_ak; ++k) {
+            ab[k] = vaddvq_f32(ab_vec[k]), a2[k] = vaddvq_f32(a2_vec[k]), b2[k] = vaddvq_f32(b2_vec[k]);
+            ab_deltas_sq[k] = vaddvq_f32(ab_deltas_sq_vec[k]);
+        }
+#endif
+        for (; i < dim; ++i) {
+            for (std::size_t k = 0; k != group_ak; ++k) {
+                if constexpr (metric_ak == metric_kind_t::l2sq_k)
+                    ab_deltas_sq[k] += square(a[i] - bs[k][i]);
+                else
+                    ab[k] += a[i] * bs[k][i];
+                if constexpr (metric_ak == metric_kind_t::cos_k)
+                    a2[k] += square(a[i]), b2[k] += square(bs[k][i]);
+            }
+        }
+
+        for (std::size_t k = 0; k != group_ak; ++k) {
+            if constexpr (metric_ak == metric_kind_t::l2sq_k)
+                results[k] = ab_deltas_sq[k];
+            else if constexpr (metric_ak == metric_kind_t::ip_k)
+                results[k] = 1 - ab[k];
+            else {
+                result_t result_if_zero[2][2];
+                result_if_zero[0][0] = 1 - ab[k] / (std::sqrt(a2[k]) * std::sqrt(b2[k]));
+                result_if_zero[0][1] = result_if_zero[1][0] = 1;
+                result_if_zero[1][1] = 0;
+                results[k] = result_if_zero[a2[k] == 0][b2[k] == 0];
+            }
+        }
+    }
+
+#if defined(__AVX2__) && !defined(__AVX512F__)
+    static f32_t reduce_add_(__m256 vec) noexcept {
+        __m128 half_vec = _mm_add_ps(_mm256_castps256_ps128(vec), _mm256_extractf128_ps(vec, 1));
+        half_vec = _mm_hadd_ps(half_vec, half_vec);
+        half_vec = _mm_hadd_ps(half_vec, half_vec);
+        return _mm_cvtss_f32(half_vec);
+    }
+#endif
+};
+
 /**
  *  @brief  Hamming distance computes the number of differing bits in
  *          two arrays of integers. An example would be a textual document,
@@ -1292,6 +2007,351 @@ template <typename scalar_at = float, typename result_at = scalar_at> struct met
     }
 };
 
+/**
+ *  @brief  Instruction sets, that the hand-written kernels of `metric_punned_t` are compiled for,
+ *          regardless of the flags the library itself is compiled with.
+ */
+enum class native_isa_t : std::uint8_t {
+    serial_k = 0,
+    neon_k,
+    avx2_k,
+    avx512_k,
+    avx512vnni_k,
+};
+
+/**
+ *  @brief  Detects the most capable of `native_isa_t`, that the current CPU supports.
+ *          Queries CPUID on x86 once per process. Every 64-bit Arm CPU supports NEON.
+ */
+inline native_isa_t native_isa() noexcept {
+#if USEARCH_USE_NATIVE_KERNELS && defined(USEARCH_DEFINED_X86)
+    static native_isa_t const isa = [] {
+        __builtin_cpu_init();
+        bool const avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && //
+                          __builtin_cpu_supports("f16c");
+        bool const avx512 = avx2 && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+                            __builtin_cpu_supports("avx512vl");
+        if (avx512 && __builtin_cpu_supports("avx512vnni"))
+            return native_isa_t::avx512vnni_k;
+        if (avx512)
+            return native_isa_t::avx512_k;
+        if (avx2)
+            return native_isa_t::avx2_k;
+        return native_isa_t::serial_k;
+    }();
+    return isa;
+#elif USEARCH_USE_NATIVE_KERNELS
+    return native_isa_t::neon_k;
+#else
+    return native_isa_t::serial_k;
+#endif
+}
+
+inline char const* native_isa_name(native_isa_t isa) noexcept {
+    switch (isa) {
+    case native_isa_t::serial_k: return "serial";
+    case native_isa_t::neon_k: return "neon";
+    case native_isa_t::avx2_k: return "avx2";
+    case native_isa_t::avx512_k: return "avx512";
+    case native_isa_t::avx512vnni_k: return "avx512+vnni";
+    default: return "unknown";
+    }
+}
+
+/**
+ *  @brief  Combines the sums, accumulated by the hand-written kernels, into the distance of the given metric,
+ *          like `::metric_ip_gt`, `::metric_cos_gt`, and `::metric_l2sq_gt` do.
+ */
+template <metric_kind_t metric_ak>
+inline f32_t native_distance(f32_t ab, f32_t a2, f32_t b2, f32_t ab_deltas_sq) noexcept {
+    if constexpr (metric_ak == metric_kind_t::l2sq_k)
+        return ab_deltas_sq;
+    else if constexpr (metric_ak == metric_kind_t::ip_k)
+        return 1 - ab;
+    else {
+        f32_t result_if_zero[2][2];
+        result_if_zero[0][0] = 1 - ab / (std::sqrt(a2) * std::sqrt(b2));
+        result_if_zero[0][1] = result_if_zero[1][0] = 1;
+        result_if_zero[1][1] = 0;
+        return result_if_zero[a2 == 0][b2 == 0];
+    }
+}
+
+/**
+ *  @brief  Largest number of dimensions, for which the hand-written `i8_t` kernels can't overflow
+ *          their 32-bit integer accumulators, even when squaring the largest differences.
+ */
+constexpr std::size_t native_i8_dimensions_limit_k = 32768;
+
+#if USEARCH_USE_NATIVE_KERNELS && defined(USEARCH_DEFINED_X86)
+
+#define usearch_target_avx2_m __attribute__((target("avx2,fma,f16c")))
+#define usearch_target_avx512_m __attribute__((target("avx2,fma,f16c,avx512f,avx512bw,avx512vl")))
+#define usearch_target_avx512vnni_m __attribute__((target("avx2,fma,f16c,avx512f,avx512bw,avx512vl,avx512vnni")))
+
+// GCC 12 reports the `_mm*_undefined_*` placeholders of its own AVX-512 headers as uninitialized,
+// once those are inlined into functions with a `target` attribute.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+/**
+ *  @brief  AVX2 kernels for `f32_t` and `f16_t` vectors, the latter converted with F16C.
+ *          The tail of the vectors is copied into zero-padded buffers, to be processed in full registers.
+ */
+template <typename scalar_at, metric_kind_t metric_ak> struct metric_avx2_gt {
+    using scalar_t = scalar_at;
+    using result_t = f32_t;
+
+    usearch_target_avx2_m result_t operator()(scalar_t const* a, scalar_t const* b, std::size_t dim) const noexcept {
+        __m256 ab_vec = _mm256_setzero_ps(), a2_vec = ab_vec, b2_vec = ab_vec, ab_deltas_sq_vec = ab_vec;
+        byte_t a_tail[8 * sizeof(scalar_t)]{}, b_tail[8 * sizeof(scalar_t)]{};
+        for (std::size_t i = 0; i < dim; i += 8) {
+            scalar_t const* a_chunk = a + i;
+            scalar_t const* b_chunk = b + i;
+            if (i + 8 > dim) {
+                std::memcpy(a_tail, a_chunk, (dim - i) * sizeof(scalar_t));
+                std::memcpy(b_tail, b_chunk, (dim - i) * sizeof(scalar_t));
+                a_chunk = reinterpret_cast<scalar_t const*>(a_tail);
+                b_chunk = reinterpret_cast<scalar_t const*>(b_tail);
+            }
+            __m256 a_vec = load_(a_chunk), b_vec = load_(b_chunk);
+            if constexpr (metric_ak == metric_kind_t::l2sq_k) {
+                __m256 delta_vec = _mm256_sub_ps(a_vec, b_vec);
+                ab_deltas_sq_vec = _mm256_fmadd_ps(delta_vec, delta_vec, ab_deltas_sq_vec);
+            } else {
+                ab_vec = _mm256_fmadd_ps(a_vec, b_vec, ab_vec);
+            }
+            if constexpr (metric_ak == metric_kind_t::cos_k) {
+                a2_vec = _mm256_fmadd_ps(a_vec, a_vec, a2_vec);
+                b2_vec = _mm256_fmadd_ps(b_vec, b_vec, b2_vec);
+            }
+        }
+        return native_distance<metric_ak>(reduce_add_(ab_vec), reduce_add_(a2_vec), reduce_add_(b2_vec),
+                                          reduce_add_(ab_deltas_sq_vec));
+    }
+
+  private:
+    usearch_target_avx2_m static __m256 load_(f32_t const* chunk) noexcept { return _mm256_loadu_ps(chunk); }
+    usearch_target_avx2_m static __m256 load_(f16_t const* chunk) noexcept {
+        return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(chunk)));
+    }
+    usearch_target_avx2_m static f32_t reduce_add_(__m256 vec) noexcept {
+        __m128 half_vec = _mm_add_ps(_mm256_castps256_ps128(vec), _mm256_extractf128_ps(vec, 1));
+        half_vec = _mm_hadd_ps(half_vec, half_vec);
+        half_vec = _mm_hadd_ps(half_vec, half_vec);
+        return _mm_cvtss_f32(half_vec);
+    }
+};
+
+/**
+ *  @brief  AVX2 kernels for `i8_t` vectors, widened to 16-bit integers and multiplied in pairs,
+ *          accumulating exact 32-bit sums.
+ */
+template <metric_kind_t metric_ak> struct metric_avx2_gt<i8_t, metric_ak> {
+    using scalar_t = i8_t;
+    using result_t = f32_t;
+
+    usearch_target_avx2_m result_t operator()(i8_t const* a, i8_t const* b, std::size_t dim) const noexcept {
+        __m256i ab_vec = _mm256_setzero_si256(), a2_vec = ab_vec, b2_vec = ab_vec, ab_deltas_sq_vec = ab_vec;
+        i8_t a_tail[16]{}, b_tail[16]{};
+        for (std::size_t i = 0; i < dim; i += 16) {
+            i8_t const* a_chunk = a + i;
+            i8_t const* b_chunk = b + i;
+            if (i + 16 > dim) {
+                std::memcpy(a_tail, a_chunk, dim - i);
+                std::memcpy(b_tail, b_chunk, dim - i);
+                a_chunk = a_tail, b_chunk = b_tail;
+            }
+            __m256i a_vec = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const*>(a_chunk)));
+            __m256i b_vec = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const*>(b_chunk)));
+            if constexpr (metric_ak == metric_kind_t::l2sq_k) {
+                __m256i delta_vec = _mm256_sub_epi16(a_vec, b_vec);
+                ab_deltas_sq_vec = _mm256_add_epi32(ab_deltas_sq_vec, _mm256_madd_epi16(delta_vec, delta_vec));
+            } else {
+                ab_vec = _mm256_add_epi32(ab_vec, _mm256_madd_epi16(a_vec, b_vec));
+            }
+            if constexpr (metric_ak == metric_kind_t::cos_k) {
+                a2_vec = _mm256_add_epi32(a2_vec, _mm256_madd_epi16(a_vec, a_vec));
+                b2_vec = _mm256_add_epi32(b2_vec, _mm256_madd_epi16(b_vec, b_vec));
+            }
+        }
+        return native_distance<metric_ak>(reduce_add_(ab_vec), reduce_add_(a2_vec), reduce_add_(b2_vec),
+                                          reduce_add_(ab_deltas_sq_vec));
+    }
+
+  private:
+    usearch_target_avx2_m static f32_t reduce_add_(__m256i vec) noexcept {
+        __m128i half_vec = _mm_add_epi32(_mm256_castsi256_si128(vec), _mm256_extracti128_si256(vec, 1));
+        half_vec = _mm_hadd_epi32(half_vec, half_vec);
+        half_vec = _mm_hadd_epi32(half_vec, half_vec);
+        return static_cast<f32_t>(_mm_cvtsi128_si32(half_vec));
+    }
+};
+
+/**
+ *  @brief  AVX-512 kernels for `f32_t` and `f16_t` vectors, the latter converted with `_mm512_cvtph_ps`.
+ *          The tail of the vectors is fetched with masked loads.
+ */
+template <typename scalar_at, metric_kind_t metric_ak> struct metric_avx512_gt {
+    using scalar_t = scalar_at;
+    using result_t = f32_t;
+
+    usearch_target_avx512_m result_t operator()(scalar_t const* a, scalar_t const* b, std::size_t dim) const noexcept {
+        __m512 ab_vec = _mm512_setzero_ps(), a2_vec = ab_vec, b2_vec = ab_vec, ab_deltas_sq_vec = ab_vec;
+        for (std::size_t i = 0; i < dim; i += 16) {
+            __mmask16 mask = i + 16 <= dim ? __mmask16(0xFFFF) : __mmask16((1u << (dim - i)) - 1u);
+            __m512 a_vec = load_(a + i, mask), b_vec = load_(b + i, mask);
+            if constexpr (metric_ak == metric_kind_t::l2sq_k) {
+                __m512 delta_vec = _mm512_sub_ps(a_vec, b_vec);
+                ab_deltas_sq_vec = _mm512_fmadd_ps(delta_vec, delta_vec, ab_deltas_sq_vec);
+            } else {
+                ab_vec = _mm512_fmadd_ps(a_vec, b_vec, ab_vec);
+            }
+            if constexpr (metric_ak == metric_kind_t::cos_k) {
+                a2_vec = _mm512_fmadd_ps(a_vec, a_vec, a2_vec);
+                b2_vec = _mm512_fmadd_ps(b_vec, b_vec, b2_vec);
+            }
+        }
+        return native_distance<metric_ak>(_mm512_reduce_add_ps(ab_vec), _mm512_reduce_add_ps(a2_vec),
+                                          _mm512_reduce_add_ps(b2_vec), _mm512_reduce_add_ps(ab_deltas_sq_vec));
+    }
+
+  private:
+    usearch_target_avx512_m static __m512 load_(f32_t const* chunk, __mmask16 mask) noexcept {
+        return _mm512_maskz_loadu_ps(mask, chunk);
+    }
+    usearch_target_avx512_m static __m512 load_(f16_t const* chunk, __mmask16 mask) noexcept {
+        return _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, chunk));
+    }
+};
+
+/**
+ *  @brief  AVX-512 VNNI kernels for `i8_t` vectors, widened to 16-bit integers and multiplied in pairs
+ *          with `_mm512_dpwssd_epi32`, accumulating exact 32-bit sums. The tail is fetched with masked loads.
+ */
+template <metric_kind_t metric_ak> struct metric_avx512vnni_gt {
+    using scalar_t = i8_t;
+    using result_t = f32_t;
+
+    usearch_target_avx512vnni_m result_t operator()(i8_t const* a, i8_t const* b, std::size_t dim) const noexcept {
+        __m512i ab_vec = _mm512_setzero_si512(), a2_vec = ab_vec, b2_vec = ab_vec, ab_deltas_sq_vec = ab_vec;
+        for (std::size_t i = 0; i < dim; i += 32) {
+            __mmask32 mask = i + 32 <= dim ? __mmask32(0xFFFFFFFF) : __mmask32((1u << (dim - i)) - 1u);
+            __m512i a_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, a + i));
+            __m512i b_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, b + i));
+            if constexpr (metric_ak == metric_kind_t::l2sq_k) {
+                __m512i delta_vec = _mm512_sub_epi16(a_vec, b_vec);
+                ab_deltas_sq_vec = _mm512_dpwssd_epi32(ab_deltas_sq_vec, delta_vec, delta_vec);
+            } else {
+                ab_vec = _mm512_dpwssd_epi32(ab_vec, a_vec, b_vec);
+            }
+            if constexpr (metric_ak == metric_kind_t::cos_k) {
+                a2_vec = _mm512_dpwssd_epi32(a2_vec, a_vec, a_vec);
+                b2_vec = _mm512_dpwssd_epi32(b2_vec, b_vec, b_vec);
+            }
+        }
+        return native_distance<metric_ak>(
+            static_cast<f32_t>(_mm512_reduce_add_epi32(ab_vec)), static_cast<f32_t>(_mm512_reduce_add_epi32(a2_vec)),
+            static_cast<f32_t>(_mm512_reduce_add_epi32(b2_vec)),
+            static_cast<f32_t>(_mm512_reduce_add_epi32(ab_deltas_sq_vec)));
+    }
+};
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#elif USEARCH_USE_NATIVE_KERNELS
+
+/**
+ *  @brief  NEON kernels for `f32_t` and `f16_t` vectors, the latter converted with `vcvt_f32_f16`.
+ *          The tail of the vectors is copied into zero-padded buffers, to be processed in full registers.
+ */
+template <typename scalar_at, metric_kind_t metric_ak> struct metric_neon_gt {
+    using scalar_t = scalar_at;
+    using result_t = f32_t;
+
+    inline result_t operator()(scalar_t const* a, scalar_t const* b, std::size_t dim) const noexcept {
+        float32x4_t ab_vec = vdupq_n_f32(0), a2_vec = ab_vec, b2_vec = ab_vec, ab_deltas_sq_vec = ab_vec;
+        byte_t a_tail[4 * sizeof(scalar_t)]{}, b_tail[4 * sizeof(scalar_t)]{};
+        for (std::size_t i = 0; i < dim; i += 4) {
+            scalar_t const* a_chunk = a + i;
+            scalar_t const* b_chunk = b + i;
+            if (i + 4 > dim) {
+                std::memcpy(a_tail, a_chunk, (dim - i) * sizeof(scalar_t));
+                std::memcpy(b_tail, b_chunk, (dim - i) * sizeof(scalar_t));
+                a_chunk = reinterpret_cast<scalar_t const*>(a_tail);
+                b_chunk = reinterpret_cast<scalar_t const*>(b_tail);
+            }
+            float32x4_t a_vec = load_(a_chunk), b_vec = load_(b_chunk);
+            if constexpr (metric_ak == metric_kind_t::l2sq_k) {
+                float32x4_t delta_vec = vsubq_f32(a_vec, b_vec);
+                ab_deltas_sq_vec = vfmaq_f32(ab_deltas_sq_vec, delta_vec, delta_vec);
+            } else {
+                ab_vec = vfmaq_f32(ab_vec, a_vec, b_vec);
+            }
+            if constexpr (metric_ak == metric_kind_t::cos_k) {
+                a2_vec = vfmaq_f32(a2_vec, a_vec, a_vec);
+                b2_vec = vfmaq_f32(b2_vec, b_vec, b_vec);
+            }
+        }
+        return native_distance<metric_ak>(vaddvq_f32(ab_vec), vaddvq_f32(a2_vec), vaddvq_f32(b2_vec),
+                                          vaddvq_f32(ab_deltas_sq_vec));
+    }
+
+  private:
+    static float32x4_t load_(f32_t const* chunk) noexcept { return vld1q_f32(chunk); }
+    static float32x4_t load_(f16_t const* chunk) noexcept {
+        return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(reinterpret_cast<std::uint16_t const*>(chunk))));
+    }
+};
+
+/**
+ *  @brief  NEON kernels for `i8_t` vectors, widened to 16-bit integers and multiplied into exact 32-bit sums.
+ */
+template <metric_kind_t metric_ak> struct metric_neon_gt<i8_t, metric_ak> {
+    using scalar_t = i8_t;
+    using result_t = f32_t;
+
+    inline result_t operator()(i8_t const* a, i8_t const* b, std::size_t dim) const noexcept {
+        int32x4_t ab_vec = vdupq_n_s32(0), a2_vec = ab_vec, b2_vec = ab_vec, ab_deltas_sq_vec = ab_vec;
+        i8_t a_tail[8]{}, b_tail[8]{};
+        for (std::size_t i = 0; i < dim; i += 8) {
+            i8_t const* a_chunk = a + i;
+            i8_t const* b_chunk = b + i;
+            if (i + 8 > dim) {
+                std::memcpy(a_tail, a_chunk, dim - i);
+                std::memcpy(b_tail, b_chunk, dim - i);
+                a_chunk = a_tail, b_chunk = b_tail;
+            }
+            int16x8_t a_vec = vmovl_s8(vld1_s8(a_chunk)), b_vec = vmovl_s8(vld1_s8(b_chunk));
+            if constexpr (metric_ak == metric_kind_t::l2sq_k) {
+                int16x8_t delta_vec = vsubq_s16(a_vec, b_vec);
+                ab_deltas_sq_vec = vmlal_s16(ab_deltas_sq_vec, vget_low_s16(delta_vec), vget_low_s16(delta_vec));
+                ab_deltas_sq_vec = vmlal_high_s16(ab_deltas_sq_vec, delta_vec, delta_vec);
+            } else {
+                ab_vec = vmlal_s16(ab_vec, vget_low_s16(a_vec), vget_low_s16(b_vec));
+                ab_vec = vmlal_high_s16(ab_vec, a_vec, b_vec);
+            }
+            if constexpr (metric_ak == metric_kind_t::cos_k) {
+                a2_vec = vmlal_s16(a2_vec, vget_low_s16(a_vec), vget_low_s16(a_vec));
+                a2_vec = vmlal_high_s16(a2_vec, a_vec, a_vec);
+                b2_vec = vmlal_s16(b2_vec, vget_low_s16(b_vec), vget_low_s16(b_vec));
+                b2_vec = vmlal_high_s16(b2_vec, b_vec, b_vec);
+            }
+        }
+        return native_distance<metric_ak>(static_cast<f32_t>(vaddvq_s32(ab_vec)),
+                                          static_cast<f32_t>(vaddvq_s32(a2_vec)),
+                                          static_cast<f32_t>(vaddvq_s32(b2_vec)),
+                                          static_cast<f32_t>(vaddvq_s32(ab_deltas_sq_vec)));
+    }
+};
+
+#endif
+
 using distance_punned_t = float;
 using span_punned_t = span_gt<byte_t const>;
 
@@ -1318,10 +2378,14 @@ class metric_punned_t {
   private:
     using punned_arg_t = std::size_t;
     using punned_ptr_t = result_t (*)(std::size_t, std::size_t, std::size_t, std::size_t);
+    using punned_batch_ptr_t = void (*)(byte_t const*, byte_t const* const*, std::size_t, std::size_t, result_t*);
 
     punned_ptr_t raw_ptr_ = nullptr;
+    punned_ptr_t raw_aligned_ptr_ = nullptr;
+    punned_batch_ptr_t raw_batch_ptr_ = nullptr;
     punned_arg_t raw_arg3_ = 0;
     punned_arg_t raw_arg4_ = 0;
+    bool builtin_ = false;
 
     std::size_t dimensions_ = 0;
     metric_kind_t metric_kind_ = metric_kind_t::unknown_k;
@@ -1330,6 +2394,7 @@ class metric_punned_t {
 #if USEARCH_USE_SIMSIMD
     simsimd_capability_t isa_kind_ = simsimd_cap_serial_k;
 #endif
+    native_isa_t native_isa_ = native_isa_t::serial_k;
 
   public:
     /**
@@ -1341,6 +2406,35 @@ class metric_punned_t {
         return raw_ptr_(reinterpret_cast<punned_arg_t>(a), reinterpret_cast<punned_arg_t>(b), raw_arg3_, raw_arg4_);
     }
 
+    /**
+     *  @brief  Computes the distance between two vectors of fixed length, the second of which is aligned
+     *          to `vector_alignment_k` bytes, like most vectors of the internal lantern storage.
+     */
+    inline result_t aligned(byte_t const* a, byte_t const* b) const noexcept {
+        return raw_aligned_ptr_(reinterpret_cast<punned_arg_t>(a), reinterpret_cast<punned_arg_t>(b), raw_arg3_,
+                                raw_arg4_);
+    }
+
+    /**
+     *  @brief  Computes the distances between one vector and `count` others of the same length,
+     *          exporting them into `results`. Uses one-to-many kernels, where available,
+     *          or falls back to calling the metric for every vector.
+     */
+    inline void batch(byte_t const* a, byte_t const* const* bs, std::size_t count, result_t* results) const noexcept {
+        if (raw_batch_ptr_) {
+            raw_batch_ptr_(a, bs, count, raw_arg3_, results);
+            return;
+        }
+        for (std::size_t i = 0; i != count; ++i)
+            results[i] = operator()(a, bs[i]);
+    }
+
+    /**
+     *  @brief  Whether `batch` uses a one-to-many kernel of a symmetric metric, rounding just like `aligned`,
+     *          rather than calling the metric for every vector.
+     */
+    inline bool batched() const noexcept { return raw_batch_ptr_ != nullptr; }
+
     inline metric_punned_t() noexcept = default;
     inline metric_punned_t(metric_punned_t const&) noexcept = default;
     inline metric_punned_t& operator=(metric_punned_t const&) noexcept = default;
@@ -1348,14 +2442,13 @@ class metric_punned_t {
         std::size_t dimensions,                            //
         metric_kind_t metric_kind = metric_kind_t::l2sq_k, //
         scalar_kind_t scalar_kind = scalar_kind_t::f32_k) noexcept
-        : raw_arg3_(dimensions), raw_arg4_(dimensions), dimensions_(dimensions), metric_kind_(metric_kind),
-          scalar_kind_(scalar_kind) {
+        : raw_arg3_(dimensions), raw_arg4_(dimensions), builtin_(true), dimensions_(dimensions),
+          metric_kind_(metric_kind), scalar_kind_(scalar_kind) {
 
-#if USEARCH_USE_SIMSIMD
-        if (!configure_with_simsimd())
+        if (!configure_with_simsimd() && !configure_with_native())
             configure_with_auto_vectorized();
-#endif
-        configure_with_auto_vectorized();
+        configure_aligned();
+        configure_batch();
 
         if (scalar_kind == scalar_kind_t::b1x8_k)
             raw_arg3_ = raw_arg4_ = divide_round_up<CHAR_BIT>(dimensions_);
@@ -1366,8 +2459,8 @@ class metric_punned_t {
         std::uintptr_t metric_uintptr, metric_punned_signature_t signature, //
         metric_kind_t metric_kind,                                          //
         scalar_kind_t scalar_kind) noexcept
-        : raw_ptr_(reinterpret_cast<punned_ptr_t>(metric_uintptr)), dimensions_(dimensions), metric_kind_(metric_kind),
-          scalar_kind_(scalar_kind) {
+        : raw_ptr_(reinterpret_cast<punned_ptr_t>(metric_uintptr)), raw_aligned_ptr_(raw_ptr_),
+          dimensions_(dimensions), metric_kind_(metric_kind), scalar_kind_(scalar_kind) {
 
         // We don't need to explicitly parse signature, as all of them are compatible.
         (void)signature;
@@ -1376,8 +2469,12 @@ class metric_punned_t {
     inline std::size_t dimensions() const noexcept { return dimensions_; }
     inline metric_kind_t metric_kind() const noexcept { return metric_kind_; }
     inline scalar_kind_t scalar_kind() const noexcept { return scalar_kind_; }
+    /// @brief  Whether distances are computed by the kernels of this library, rather than a user-defined function.
+    inline bool builtin() const noexcept { return builtin_; }
 
     inline char const* isa_name() const noexcept {
+        if (native_isa_ != native_isa_t::serial_k)
+            return native_isa_name(native_isa_);
 #if USEARCH_USE_SIMSIMD
         switch (isa_kind_) {
         case simsimd_cap_serial_k: return "serial";
@@ -1443,6 +2540,59 @@ class metric_punned_t {
     bool configure_with_simsimd() noexcept { return false; }
 #endif
 
+    /// Picks the hand-written kernels for the `native_isa()` of the machine, if there are any for this metric
+    bool configure_with_native() noexcept {
+        switch (scalar_kind_) {
+        case scalar_kind_t::f32_k: return configure_with_native_<f32_t>();
+        case scalar_kind_t::f16_k: return configure_with_native_<f16_t>();
+        case scalar_kind_t::i8_k:
+            return dimensions_ <= native_i8_dimensions_limit_k && configure_with_native_<i8_t>();
+        default: return false;
+        }
+    }
+
+    template <typename scalar_at> bool configure_with_native_() noexcept {
+        switch (metric_kind_) {
+        case metric_kind_t::ip_k: return configure_with_native_<scalar_at, metric_kind_t::ip_k>();
+        case metric_kind_t::cos_k: return configure_with_native_<scalar_at, metric_kind_t::cos_k>();
+        case metric_kind_t::l2sq_k: return configure_with_native_<scalar_at, metric_kind_t::l2sq_k>();
+        default: return false;
+        }
+    }
+
+    template <typename scalar_at, metric_kind_t metric_ak> bool configure_with_native_() noexcept {
+        native_isa_t const isa = native_isa();
+#if USEARCH_USE_NATIVE_KERNELS && defined(USEARCH_DEFINED_X86)
+        constexpr bool integer_k = std::is_same<scalar_at, i8_t>::value;
+        if constexpr (integer_k) {
+            if (isa == native_isa_t::avx512vnni_k) {
+                raw_ptr_ = (punned_ptr_t)&equidimensional_<metric_avx512vnni_gt<metric_ak>>;
+                native_isa_ = native_isa_t::avx512vnni_k;
+                return true;
+            }
+        } else {
+            if (isa == native_isa_t::avx512_k || isa == native_isa_t::avx512vnni_k) {
+                raw_ptr_ = (punned_ptr_t)&equidimensional_<metric_avx512_gt<scalar_at, metric_ak>>;
+                native_isa_ = native_isa_t::avx512_k;
+                return true;
+            }
+        }
+        if (isa != native_isa_t::serial_k) {
+            raw_ptr_ = (punned_ptr_t)&equidimensional_<metric_avx2_gt<scalar_at, metric_ak>>;
+            native_isa_ = native_isa_t::avx2_k;
+            return true;
+        }
+        return false;
+#elif USEARCH_USE_NATIVE_KERNELS
+        raw_ptr_ = (punned_ptr_t)&equidimensional_<metric_neon_gt<scalar_at, metric_ak>>;
+        native_isa_ = isa;
+        return true;
+#else
+        (void)isa;
+        return false;
+#endif
+    }
+
     void configure_with_auto_vectorized() noexcept {
         switch (metric_kind_) {
         case metric_kind_t::ip_k: {
@@ -1521,6 +2671,46 @@ class metric_punned_t {
         }
     }
 
+    /// Picks kernels with aligned loads, where available, or falls back to the general ones
+    void configure_aligned() noexcept {
+        raw_aligned_ptr_ = raw_ptr_;
+        if (scalar_kind_ != scalar_kind_t::f32_k)
+            return;
+        switch (metric_kind_) {
+        case metric_kind_t::l2sq_k:
+            raw_aligned_ptr_ = (punned_ptr_t)&equidimensional_<metric_aligned_f32_gt<metric_kind_t::l2sq_k>>;
+            break;
+        case metric_kind_t::ip_k:
+            raw_aligned_ptr_ = (punned_ptr_t)&equidimensional_<metric_aligned_f32_gt<metric_kind_t::ip_k>>;
+            break;
+        case metric_kind_t::cos_k:
+            raw_aligned_ptr_ = (punned_ptr_t)&equidimensional_<metric_aligned_f32_gt<metric_kind_t::cos_k>>;
+            break;
+        default: break;
+        }
+    }
+
+    /// Picks one-to-many kernels, where available, leaving the rest to `batch` fallbacks
+    void configure_batch() noexcept {
+        raw_batch_ptr_ = nullptr;
+        if (scalar_kind_ != scalar_kind_t::f32_k)
+            return;
+        switch (metric_kind_) {
+        case metric_kind_t::l2sq_k: raw_batch_ptr_ = &one_to_many_<metric_batch_f32_gt<metric_kind_t::l2sq_k>>; break;
+        case metric_kind_t::ip_k: raw_batch_ptr_ = &one_to_many_<metric_batch_f32_gt<metric_kind_t::ip_k>>; break;
+        case metric_kind_t::cos_k: raw_batch_ptr_ = &one_to_many_<metric_batch_f32_gt<metric_kind_t::cos_k>>; break;
+        default: break;
+        }
+    }
+
+    template <typename typed_at>
+    inline static void one_to_many_(                                  //
+        byte_t const* a, byte_t const* const* bs, std::size_t count, //
+        std::size_t dimensions, result_t* results) noexcept {
+        using scalar_t = typename typed_at::scalar_t;
+        typed_at{}((scalar_t const*)a, reinterpret_cast<scalar_t const* const*>(bs), count, dimensions, results);
+    }
+
     template <typename typed_at>
     inline static result_t equidimensional_( //
         punned_arg_t a, punned_arg_t b,      //
@@ -1531,6 +2721,34 @@ class metric_punned_t {
     }
 };
 
+/**
+ *  @brief  Single-precision Squared Euclidean, Inner Product, or Cosine metric, with the number of dimensions
+ *          known at compile time. Exposes the same calls, as `metric_punned_t`, but without the indirection,
+ *          so that the kernels can be inlined into the traversal loops and unrolled for a constant length.
+ */
+template <metric_kind_t metric_ak, std::size_t dimensions_ak> struct metric_fixed_f32_gt {
+    using scalar_t = byte_t;
+    using result_t = distance_punned_t;
+    using angular_t = typename std::conditional<metric_ak == metric_kind_t::ip_k, //
+                                                metric_ip_gt<f32_t>, metric_cos_gt<f32_t>>::type;
+    using general_t = typename std::conditional<metric_ak == metric_kind_t::l2sq_k, //
+                                                metric_l2sq_gt<f32_t>, angular_t>::type;
+
+    static constexpr std::size_t dimensions() noexcept { return dimensions_ak; }
+    static constexpr bool batched() noexcept { return true; }
+
+    inline result_t operator()(byte_t const* a, byte_t const* b) const noexcept {
+        return general_t{}((f32_t const*)a, (f32_t const*)b, dimensions_ak);
+    }
+    inline result_t aligned(byte_t const* a, byte_t const* b) const noexcept {
+        return metric_aligned_f32_gt<metric_ak>{}((f32_t const*)a, (f32_t const*)b, dimensions_ak);
+    }
+    inline void batch(byte_t const* a, byte_t const* const* bs, std::size_t count, result_t* results) const noexcept {
+        metric_batch_f32_gt<metric_ak>{}((f32_t const*)a, reinterpret_cast<f32_t const* const*>(bs), count,
+                                         dimensions_ak, results);
+    }
+};
+
 /**
  *  @brief  View over a potentially-strided memory buffer, containing a row-major matrix.
  */
@@ -7,12 +7,18 @@
 #include <cstdio>
 #include <cstring>
 #include <exception>
+#include <memory>
 #include <mutex>
+#include <random>
 #include <thread>
 #include <usearch/index.hpp>
 #include <usearch/index_plugins.hpp>
 #include <usearch/storage.hpp>
 
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h> // `_mm256_i32gather_ps`
+#endif
+
 #ifndef NDEBUG
 #include <inttypes.h>
 #include <iostream>
@@ -52,6 +58,7 @@ class lantern_storage_gt {
     using node_t = node_at<key_t, compressed_slot_at>;
     using span_bytes_t = span_gt<byte_t>;
     using node_retriever_t = void* (*)(void* ctx, unsigned long long index);
+    using node_retriever_batch_t = void (*)(void* ctx, unsigned long long const* indices, std::size_t count);
 
     struct storage_metadata {
         bool pq;
@@ -60,6 +67,8 @@ class lantern_storage_gt {
         void* retriever_ctx;
         node_retriever_t retriever;
         node_retriever_t retriever_mut;
+        bool arena;
+        bool colocated;
     };
 
     using storage_metadata_t = storage_metadata;
@@ -72,12 +81,15 @@ class lantern_storage_gt {
     using offsets_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<std::size_t>;
     using vectors_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<byte_t*>;
 
-    using nodes_mutexes_t = bitset_gt<dynamic_allocator_t>;
+    using nodes_mutexes_t = seqlocks_gt<dynamic_allocator_t>;
     using nodes_t = buffer_gt<node_t, nodes_allocator_t>;
     using vectors_t = std::vector<span_bytes_t>;
 
     class codebook_t {
 
+        /// Bounds the stack space used for transposed centroids of a subspace in `compress_batch`
+        static constexpr size_t max_transposed_k = 4096;
+
         const float* tape_{};
         size_t dimensions_{};
         size_t subvector_dim_{};
@@ -97,48 +109,140 @@ class lantern_storage_gt {
 
         size_t num_subvectors() const { return dimensions_ / subvector_dim_; }
         size_t num_centroids() const { return num_centroids_; }
+        size_t dimensions() const { return dimensions_; }
 
         span_floats_t get(size_t centroid_id, size_t subvector_id) const {
             return span_floats_t{tape_ + centroid_id * dimensions_ + subvector_id * subvector_dim_, subvector_dim_};
         }
 
-        static float distance(span_floats_t v1, span_floats_t v2) {
-            float dist = 0;
-            for (size_t i = 0; i < v1.size(); i++) {
-                dist += (v1[i] - v2[i]) * (v1[i] - v2[i]);
-            }
-            return dist;
+        void compress(const float* vector, byte_t* dst) const {
+            compress_batch(vector, 1, dimensions_ * sizeof(float), dst);
         }
 
-        void compress(const float* vector, byte_t* dst) const {
+        /**
+         *  @brief  Encodes @p count vectors, located @p stride bytes apart, into `num_subvectors()` codes each,
+         *          written contiguously into @p dst. Doesn't allocate.
+         *
+         *  Centroids of short subspaces are transposed into a stack buffer once per batch, so that distances
+         *  to all centroids are accumulated in a loop vectorized across centroids. Longer subspaces are
+         *  compared with an L2 kernel vectorized across dimensions of the contiguous centroid tape.
+         */
+        void compress_batch(const float* vectors, size_t count, size_t stride, byte_t* dst) const {
             expect(tape_ != nullptr, "compress called on uninitialized codebook");
             expect(num_centroids_ <= 256, "num centroids must fit in a byte");
-            std::vector<byte_t> quantized;
-            quantized.reserve(num_subvectors());
-
-            for (size_t i = 0, id = 0; i < dimensions_; i += subvector_dim_, id++) {
-                const span_floats_t subvector{vector + i, subvector_dim_};
-                float min_dist = std::numeric_limits<float>::max();
-                byte_t min_centroid = 0;
-
-                for (byte_t c = 0; (size_t)c < num_centroids_; c++) {
-                    span_floats_t ci = get(c, id);
-                    float dist = distance(subvector, ci);
-                    if (dist < min_dist) {
-                        min_dist = dist;
-                        min_centroid = c;
+
+            size_t const num_subvectors = this->num_subvectors();
+            bool const transpose = subvector_dim_ * num_centroids_ <= max_transposed_k;
+            float transposed[max_transposed_k];
+            float distances[256];
+            metric_l2sq_gt<float> l2sq;
+
+            for (size_t subvector_id = 0; subvector_id != num_subvectors; ++subvector_id) {
+                size_t const offset = subvector_id * subvector_dim_;
+                if (transpose)
+                    for (size_t centroid_id = 0; centroid_id != num_centroids_; ++centroid_id)
+                        for (size_t i = 0; i != subvector_dim_; ++i)
+                            transposed[i * num_centroids_ + centroid_id] =
+                                tape_[centroid_id * dimensions_ + offset + i];
+
+                for (size_t vector_id = 0; vector_id != count; ++vector_id) {
+                    const float* subvector = reinterpret_cast<const float*>( //
+                                                 reinterpret_cast<const byte_t*>(vectors) + vector_id * stride) +
+                                             offset;
+                    if (transpose) {
+                        std::fill_n(distances, num_centroids_, 0.f);
+                        for (size_t i = 0; i != subvector_dim_; ++i) {
+                            float const scalar = subvector[i];
+                            const float* centroids_scalars = transposed + i * num_centroids_;
+                            for (size_t centroid_id = 0; centroid_id != num_centroids_; ++centroid_id)
+                                distances[centroid_id] += (scalar - centroids_scalars[centroid_id]) *
+                                                          (scalar - centroids_scalars[centroid_id]);
+                        }
+                    } else {
+                        for (size_t centroid_id = 0; centroid_id != num_centroids_; ++centroid_id)
+                            distances[centroid_id] =
+                                l2sq(subvector, tape_ + centroid_id * dimensions_ + offset, subvector_dim_);
+                    }
+                    // Find the minimum in a vectorizable pass, then its first occurrence
+                    float min_distance = distances[0];
+                    for (size_t centroid_id = 1; centroid_id != num_centroids_; ++centroid_id)
+                        min_distance = (std::min)(min_distance, distances[centroid_id]);
+                    size_t min_centroid_id = 0;
+                    while (min_centroid_id + 1 != num_centroids_ && distances[min_centroid_id] != min_distance)
+                        ++min_centroid_id;
+                    dst[vector_id * num_subvectors + subvector_id] = static_cast<byte_t>(min_centroid_id);
+                }
+            }
+        }
+
+        /**
+         *  @brief  Size of a per-query lookup table in floats. The table holds partial distances from every query
+         *          subvector to every centroid of that subspace, followed by squared centroid norms and the squared
+         *          query norm, which are only needed for the cosine metric.
+         */
+        size_t lookup_table_size() const noexcept { return 2 * num_subvectors() * num_centroids_ + 1; }
+
+        /**
+         *  @brief  Prepares the lookup table for asymmetric distance computations (ADC) between the full-precision
+         *          @p query and quantized vectors.
+         *  @return `false` if the metric can not be decomposed into per-subvector partial sums.
+         */
+        bool build_lookup_table(const float* query, metric_kind_t metric, float* table) const noexcept {
+            if (metric != metric_kind_t::l2sq_k && metric != metric_kind_t::ip_k && metric != metric_kind_t::cos_k)
+                return false;
+
+            size_t const table_stride = num_subvectors() * num_centroids_;
+            float* partials = table;
+            float* norms = table + table_stride;
+            float query_norm = 0;
+            for (size_t subvector_id = 0; subvector_id != num_subvectors(); ++subvector_id) {
+                const float* query_subvector = query + subvector_id * subvector_dim_;
+                for (size_t centroid_id = 0; centroid_id != num_centroids_; ++centroid_id) {
+                    const float* centroid = get(centroid_id, subvector_id).data();
+                    float partial = 0, norm = 0;
+                    if (metric == metric_kind_t::l2sq_k) {
+                        for (size_t i = 0; i != subvector_dim_; ++i)
+                            partial += (query_subvector[i] - centroid[i]) * (query_subvector[i] - centroid[i]);
+                    } else {
+                        for (size_t i = 0; i != subvector_dim_; ++i)
+                            partial += query_subvector[i] * centroid[i], norm += centroid[i] * centroid[i];
                     }
+                    partials[subvector_id * num_centroids_ + centroid_id] = partial;
+                    norms[subvector_id * num_centroids_ + centroid_id] = norm;
                 }
-                quantized.push_back(min_centroid);
+                for (size_t i = 0; i != subvector_dim_; ++i)
+                    query_norm += query_subvector[i] * query_subvector[i];
+            }
+            table[2 * table_stride] = query_norm;
+            return true;
+        }
+
+        /**
+         *  @brief  Computes the distance between the query, for which the @p table was built, and a quantized
+         *          vector, summing a single table entry per subvector code.
+         */
+        float lookup_distance(const float* table, metric_kind_t metric, const byte_t* quantized) const noexcept {
+            size_t const table_stride = num_subvectors() * num_centroids_;
+            switch (metric) {
+            case metric_kind_t::l2sq_k: return lookup_sum_(table, quantized);
+            case metric_kind_t::ip_k: return 1 - lookup_sum_(table, quantized);
+            case metric_kind_t::cos_k: {
+                float ab = lookup_sum_(table, quantized);
+                float b2 = lookup_sum_(table + table_stride, quantized);
+                float a2 = table[2 * table_stride];
+                // Same handling of zero-length vectors as in `metric_cos_gt`
+                if (a2 == 0 || b2 == 0)
+                    return a2 == b2 ? 0 : 1;
+                return 1 - ab / (std::sqrt(a2) * std::sqrt(b2));
+            }
+            default: return std::numeric_limits<float>::max();
             }
-            assert(quantized.size() == num_subvectors());
-            std::memcpy(dst, quantized.data(), quantized.size() * sizeof(byte_t));
         }
 
         float* decompress(const byte_t* quantized, float* vector) const {
             expect(tape_ != nullptr, "decompress called on uninitialized codebook");
             for (size_t i = 0, subvector_id = 0; i < dimensions_; i += subvector_dim_, subvector_id++) {
-                byte_t centroid_id = quantized[subvector_id]; // Get the centroid id for this subvector
+                std::size_t centroid_id = static_cast<unsigned char>(quantized[subvector_id]); // Get the centroid id
                 expect((size_t)centroid_id < num_centroids_, "corrupted centroid id");
                 span_floats_t centroid = get(centroid_id, subvector_id); // Retrieve the centroid values
 
@@ -148,6 +252,51 @@ class lantern_storage_gt {
             }
             return vector;
         }
+
+      private:
+        /**
+         *  @brief  Sums `table[subvector_id * num_centroids + quantized[subvector_id]]` over all subvectors.
+         *          The most common tables of 16 and 256 centroids per subspace are small enough to stay in L1,
+         *          so we gather 16 (AVX-512) or 8 (AVX2) entries at a time.
+         */
+        float lookup_sum_(const float* table, const byte_t* quantized) const noexcept {
+            size_t const num_subvectors = this->num_subvectors();
+            int const num_centroids = static_cast<int>(num_centroids_);
+            size_t subvector_id = 0;
+            float sum = 0;
+#if defined(__AVX512F__)
+            __m512i offsets_vec = _mm512_mullo_epi32(                                       //
+                _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), //
+                _mm512_set1_epi32(num_centroids));
+            __m512i const step_vec = _mm512_set1_epi32(16 * num_centroids);
+            __m512 sums_vec = _mm512_setzero_ps();
+            for (; subvector_id + 16 <= num_subvectors; subvector_id += 16) {
+                __m128i codes_u8_vec = _mm_loadu_si128(reinterpret_cast<__m128i const*>(quantized + subvector_id));
+                __m512i indices_vec = _mm512_add_epi32(_mm512_cvtepu8_epi32(codes_u8_vec), offsets_vec);
+                sums_vec = _mm512_add_ps(sums_vec, _mm512_i32gather_ps(indices_vec, table, sizeof(float)));
+                offsets_vec = _mm512_add_epi32(offsets_vec, step_vec);
+            }
+            sum = _mm512_reduce_add_ps(sums_vec);
+#elif defined(__AVX2__)
+            __m256i offsets_vec = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), //
+                                                     _mm256_set1_epi32(num_centroids));
+            __m256i const step_vec = _mm256_set1_epi32(8 * num_centroids);
+            __m256 sums_vec = _mm256_setzero_ps();
+            for (; subvector_id + 8 <= num_subvectors; subvector_id += 8) {
+                __m128i codes_u8_vec = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(quantized + subvector_id));
+                __m256i indices_vec = _mm256_add_epi32(_mm256_cvtepu8_epi32(codes_u8_vec), offsets_vec);
+                sums_vec = _mm256_add_ps(sums_vec, _mm256_i32gather_ps(table, indices_vec, sizeof(float)));
+                offsets_vec = _mm256_add_epi32(offsets_vec, step_vec);
+            }
+            __m128 sums_half_vec = _mm_add_ps(_mm256_castps256_ps128(sums_vec), _mm256_extractf128_ps(sums_vec, 1));
+            sums_half_vec = _mm_hadd_ps(sums_half_vec, sums_half_vec);
+            sums_half_vec = _mm_hadd_ps(sums_half_vec, sums_half_vec);
+            sum = _mm_cvtss_f32(sums_half_vec);
+#endif
+            for (; subvector_id != num_subvectors; ++subvector_id)
+                sum += table[subvector_id * num_centroids_ + static_cast<unsigned char>(quantized[subvector_id])];
+            return sum;
+        }
     };
 
     nodes_t nodes_{};
@@ -157,11 +306,20 @@ class lantern_storage_gt {
 
     node_retriever_t external_node_retriever_{};
     node_retriever_t external_node_retriever_mut_{};
+    node_retriever_batch_t external_node_retriever_batch_{};
     void* retriever_ctx_{};
 
+    /// @brief Number of slots passed to the batched node retriever at once.
+    static constexpr std::size_t retriever_batch_k = 64;
+
     precomputed_constants_t pre_{};
     allocator_at allocator_{};
     static_assert(!has_reset<allocator_at>(), "reset()-able memory allocators not supported for this storage provider");
+    // in arena mode nodes and vectors are carved out of large shared arenas, instead of `allocator_`
+    mutable slab_allocator_gt<64> arena_{};
+    bool use_arena_{};
+    // in co-located mode every vector lives in the same allocation as its node, right after it
+    bool colocated_{};
     memory_mapped_file_t viewed_file_{};
     // the next three are used only in serialization/deserialization routines to know how to serialize vectors
     // since this is only for serde/vars are marked mutable to still allow const-ness of saving method interface on
@@ -172,10 +330,14 @@ class lantern_storage_gt {
     bool pq_{};
     mutable uint64_t vector_size_bytes_{};
     codebook_t pq_codebook_{};
+    // owns the codebook tape when it was loaded from a file, rather than passed in by the user or viewed
+    std::shared_ptr<float[]> pq_codebook_tape_{};
     // defaulted to true because that is what test.cpp assumes when using this storage directly
     mutable bool exclude_vectors_ = true;
     // used to maintain proper alignment in stored indexes to make sure view() does not result in misaligned accesses
     mutable uint64_t file_offset_{};
+    // alignment of vectors in the layout of the index being serialized or deserialized, one for the packed layout
+    mutable std::size_t file_alignment_ = 1;
     const static constexpr char* default_error = "unknown lantern_storage error";
 
     // used in place of error handling throughout the class
@@ -201,24 +363,126 @@ class lantern_storage_gt {
     // leaks out
     constexpr static inline byte_t padding_buffer[64] = {0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42};
 
-    template <typename A, typename T> size_t align(T v) const {
-        return (sizeof(A) - (size_t)v % sizeof(A)) % sizeof(A);
+    static std::size_t padding_to(std::size_t offset, std::size_t alignment) noexcept {
+        return (alignment - offset % alignment) % alignment;
+    }
+
+    /**
+     *  Describes how nodes and vectors are laid out in the serialized index. Like the codebook section, it
+     *  lives in the zeroed tail of the opaque index head, so older files read as version zero, where every
+     *  vector directly follows its node. Starting with version one, when vectors are included, every node
+     *  and every vector starts at an offset aligned to `vector_alignment`, relative to the start of the index:
+     *
+     *      [ head | ... | padding | node | padding | vector | padding | node | padding | vector | ... ]
+     *
+     *  External storage and product-quantized vectors keep the packed layout.
+     */
+    struct layout_section_t {
+        std::uint8_t version;
+        std::uint8_t reserved;
+        std::uint16_t vector_alignment;
+    };
+    static_assert(sizeof(layout_section_t) == 4, "Layout section descriptor must be 4 bytes");
+
+    static constexpr std::size_t layout_section_offset_k = 56;
+    static constexpr std::uint8_t layout_section_version_k = 1;
+
+    template <typename vectors_metadata_at>
+    void read_layout_section(vectors_metadata_at const& metadata_buffer) {
+        layout_section_t section;
+        std::memcpy(&section, (byte_t const*)metadata_buffer + layout_section_offset_k, sizeof(section));
+        expect(section.version <= layout_section_version_k, "unsupported layout section version");
+        expect(!section.version || (section.vector_alignment && section.vector_alignment <= sizeof(padding_buffer)),
+               "unsupported vector alignment");
+        file_alignment_ = section.version ? section.vector_alignment : 1;
+    }
+
+    /// Alignment of full-precision vectors in memory, and in the files we write
+    std::size_t vector_alignment() const noexcept { return is_external_ak || pq_ ? 1 : vector_alignment_k; }
+    /// Padding needed at the given offset from the start of the serialized index, for its layout
+    std::size_t file_padding(std::size_t offset) const noexcept { return padding_to(offset, file_alignment_); }
+
+    /**
+     *  Describes the optional codebook section of the serialized index. The descriptor lives in the tail of
+     *  the opaque index head, which `index_dense_head_t` leaves zeroed, so files without a codebook keep the
+     *  old layout. If present, the section follows the head, padded to `codebook_alignment_k` bytes:
+     *
+     *      [ head | padding | num_centroids * dimensions floats of the codebook tape | nodes... ]
+     *
+     *  External storage never writes it, as the codebook is persisted by the caller.
+     */
+    struct codebook_section_t {
+        std::uint8_t version;
+        std::uint8_t reserved;
+        std::uint16_t num_centroids;
+        std::uint32_t num_subvectors;
+        std::uint64_t dimensions;
+
+        std::size_t tape_bytes() const noexcept { return num_centroids * dimensions * sizeof(float); }
+    };
+    static_assert(sizeof(codebook_section_t) == 16, "Codebook section descriptor must be 16 bytes");
+
+    static constexpr std::size_t codebook_section_offset_k = 64;
+    static constexpr std::uint8_t codebook_section_version_k = 1;
+    static constexpr std::size_t codebook_alignment_k = sizeof(padding_buffer);
+
+    template <typename vectors_metadata_at>
+    static codebook_section_t codebook_section(vectors_metadata_at const& metadata_buffer) noexcept {
+        static_assert(sizeof(vectors_metadata_at) >= codebook_section_offset_k + sizeof(codebook_section_t),
+                      "Index head is too small to describe the codebook");
+        codebook_section_t section;
+        std::memcpy(&section, (byte_t const*)metadata_buffer + codebook_section_offset_k, sizeof(section));
+        return section;
+    }
+
+    static std::size_t codebook_padding(std::size_t offset) noexcept {
+        return (codebook_alignment_k - offset % codebook_alignment_k) % codebook_alignment_k;
     }
 
-    template <typename T> size_t align4(T) const {
-        // todo:: fix alignment issues in lantern;
-        return 0;
-        // return align<float>(v);
+    void use_codebook(float const* tape, codebook_section_t const& section) {
+        expect(section.version == codebook_section_version_k, "unsupported codebook section version");
+        pq_ = true;
+        pq_codebook_ = codebook_t(tape, section.dimensions, section.num_centroids, section.num_subvectors);
+        if (!pq_decompress_buf_)
+            pq_decompress_buf_ = (float*)allocator_.allocate(section.dimensions * sizeof(float));
+    }
+
+    /// Allocates a node tape or a vector, from the arena in arena mode
+    byte_t* tape_allocate(std::size_t size) noexcept {
+        return use_arena_ ? arena_.allocate(size) : (byte_t*)allocator_.allocate(size);
+    }
+    void tape_deallocate(byte_t* tape, std::size_t size) noexcept {
+        if (use_arena_)
+            arena_.deallocate(tape, size);
+        else
+            allocator_.deallocate(tape, size);
+    }
+
+    /**
+     *  Co-located nodes are allocated as single blocks, laid out just like the serialized file
+     *  and the external tapes: `[ node | padding | vector ]`. So the vector of a node is found
+     *  with pointer arithmetic, and saving the index writes every block with a single call.
+     */
+    std::size_t vector_offset_bytes(std::size_t node_size) const noexcept {
+        return node_size + padding_to(node_size, vector_alignment());
+    }
+    std::size_t block_size_bytes(std::size_t node_size) const noexcept {
+        if (!colocated_)
+            return node_size;
+        std::size_t vector_end = vector_offset_bytes(node_size) + stored_vector_size_bytes();
+        return vector_end + padding_to(vector_end, vector_alignment());
     }
 
   public:
     lantern_storage_gt(storage_options options, index_config_t config, allocator_at allocator = {})
-        : pre_(node_t::precompute_(config)), allocator_(allocator), pq_(false),
+        : pre_(node_t::precompute_(config)), allocator_(allocator), use_arena_(options.arena),
+          colocated_(options.colocated && !is_external_ak), pq_(false),
           vector_size_bytes_(options.dimensions * options.scalar_bits / 8) {}
 
     lantern_storage_gt(storage_options options, index_config_t config, const float* codebook,
                        allocator_at allocator = {})
-        : pre_(node_t::precompute_(config)), allocator_(allocator), pq_(options.pq),
+        : pre_(node_t::precompute_(config)), allocator_(allocator), use_arena_(options.arena),
+          colocated_(options.colocated && !is_external_ak), pq_(options.pq),
           vector_size_bytes_(options.dimensions * options.scalar_bits / 8),
           pq_codebook_(codebook, vector_size_bytes_ / sizeof(float), options.num_centroids, options.num_subvectors) {
         assert(options.pq);
@@ -247,21 +511,28 @@ class lantern_storage_gt {
         return nodes_[idx];
     }
 
-    inline byte_t* get_vector_at(std::uint64_t idx, byte_t* dst = nullptr) const noexcept {
-        byte_t* res = nullptr;
+    /// Returns the stored bytes of a vector: full-precision scalars, or subvector codes in PQ mode
+    inline byte_t* get_stored_vector_at(std::uint64_t idx) const noexcept {
         if (loaded_ && is_external_ak) {
             assert(retriever_ctx_ != nullptr);
             char* tape = (char*)external_node_retriever_(retriever_ctx_, idx);
             node_t node{tape};
-            res = tape + node.node_size_bytes(pre_);
-        } else {
-            if (pq_) {
-                res = vectors_pq_[idx].data();
-            } else {
-                res = vectors_[idx].data();
-            }
+            return tape + vector_offset_bytes(node.node_size_bytes(pre_));
+        }
+        if (colocated_) {
+            node_t node = nodes_[idx];
+            return node.tape() + vector_offset_bytes(node.node_size_bytes(pre_));
         }
+        return pq_ ? vectors_pq_[idx].data() : vectors_[idx].data();
+    }
+
+    /// Number of bytes stored per vector: full-precision scalars, or subvector codes in PQ mode
+    std::size_t stored_vector_size_bytes() const noexcept {
+        return pq_ ? pq_codebook_.num_subvectors() : vector_size_bytes_;
+    }
 
+    inline byte_t* get_vector_at(std::uint64_t idx, byte_t* dst = nullptr) const noexcept {
+        byte_t* res = get_stored_vector_at(idx);
         if (pq_) {
             expect(dst, "in pq mode a destination must be given for get_vector_at");
             res = (byte_t*)pq_codebook_.decompress(res, (float*)dst);
@@ -270,8 +541,43 @@ class lantern_storage_gt {
         return res;
     }
 
+    /// Same as `get_vector_at`, but for stored bytes, that were copied out of the storage
+    inline byte_t const* decode_vector(byte_t const* stored, byte_t* dst) const noexcept {
+        if (pq_) {
+            expect(dst, "in pq mode a destination must be given for decode_vector");
+            return (byte_t const*)pq_codebook_.decompress(stored, (float*)dst);
+        }
+        return stored;
+    }
+
+    /**
+     *  In PQ mode vectors are scored with asymmetric distance computations (ADC): the query stays in full
+     *  precision, a lookup table of partial distances is built once per query, and every visited candidate
+     *  is scored directly from its codes, without decompressing it through `get_vector_at`.
+     */
+    std::size_t lookup_table_size() const noexcept { return pq_ ? pq_codebook_.lookup_table_size() : 0; }
+    bool lookup_table(const byte_t* query, metric_kind_t metric, float* table) const noexcept {
+        return pq_ && pq_codebook_.build_lookup_table((const float*)query, metric, table);
+    }
+    float lookup_distance(const float* table, metric_kind_t metric, std::size_t idx) const noexcept {
+        return pq_codebook_.lookup_distance(table, metric, get_stored_vector_at(idx));
+    }
+    float lookup_stored_distance(const float* table, metric_kind_t metric, const byte_t* stored) const noexcept {
+        return pq_codebook_.lookup_distance(table, metric, stored);
+    }
+
     inline size_t node_size_bytes(std::size_t idx) const noexcept { return get_node_at(idx).node_size_bytes(pre_); }
     bool is_immutable() const noexcept { return bool(viewed_file_); }
+    /// Upper bound on the bytes, that the codebook, the counters and the paddings of vectors add to a serialized index
+    /// of @p count nodes, on top of the nodes and vectors, counted by `index_dense_gt::serialized_length`
+    std::size_t serialized_overhead(std::size_t count, bool exclude_vectors) const noexcept {
+        std::size_t overhead = sizeof(vector_size_bytes_) + sizeof(node_count_);
+        if (pq_ && !is_external_ak)
+            overhead += codebook_alignment_k + pq_codebook_.num_centroids() * pq_codebook_.dimensions() * sizeof(float);
+        if (!exclude_vectors)
+            overhead += (2 * count + 1) * (vector_alignment() - 1);
+        return overhead;
+    }
 
     void set_node_retriever(void* retriever_ctx, node_retriever_t external_node_retriever,
                             node_retriever_t external_node_retriever_mut) noexcept {
@@ -280,6 +586,45 @@ class lantern_storage_gt {
         external_node_retriever_mut_ = external_node_retriever_mut;
     }
 
+    /// Optional, lets the external storage start reading many nodes at once, ahead of `get_node_at` calls
+    void set_node_retriever_batch(node_retriever_batch_t external_node_retriever_batch) noexcept {
+        external_node_retriever_batch_ = external_node_retriever_batch;
+    }
+
+    /**
+     *  Hints the storage that nodes and vectors of the given slots are about to be scored. In-memory nodes
+     *  and vectors are pulled into the CPU caches. The external storage forwards all slots to the batched
+     *  retriever, if one was set, so that it can issue the buffer reads together instead of one at a time.
+     */
+    void prefetch(std::uint64_t const* slots, std::size_t count) const noexcept {
+        if (loaded_ && is_external_ak) {
+            if (!external_node_retriever_batch_)
+                return;
+            unsigned long long indices[retriever_batch_k];
+            for (std::size_t batch_start = 0; batch_start < count; batch_start += retriever_batch_k) {
+                std::size_t const batch_count = (std::min)(retriever_batch_k, count - batch_start);
+                for (std::size_t i = 0; i != batch_count; ++i)
+                    indices[i] = slots[batch_start + i];
+                external_node_retriever_batch_(retriever_ctx_, indices, batch_count);
+            }
+            return;
+        }
+
+        // locating a co-located vector would read the node level, so we fetch a whole base-level block instead
+        if (colocated_) {
+            std::size_t const block_bytes = block_size_bytes(node_t::node_size_bytes(pre_, 0));
+            for (std::size_t i = 0; i != count; ++i)
+                prefetch_bytes(nodes_[slots[i]].tape(), block_bytes);
+            return;
+        }
+
+        std::size_t const vector_bytes = stored_vector_size_bytes();
+        for (std::size_t i = 0; i != count; ++i) {
+            prefetch_m(nodes_[slots[i]].tape());
+            prefetch_bytes(get_stored_vector_at(slots[i]), vector_bytes);
+        }
+    }
+
     storage_metadata_t metadata() {
         storage_metadata_t res = {
             .pq = pq_,
@@ -288,6 +633,8 @@ class lantern_storage_gt {
             .retriever_ctx = retriever_ctx_,
             .retriever = external_node_retriever_,
             .retriever_mut = external_node_retriever_mut_,
+            .arena = use_arena_,
+            .colocated = colocated_,
         };
         if (pq_) {
             res.pq_num_centroids = pq_codebook_.num_centroids();
@@ -305,7 +652,7 @@ class lantern_storage_gt {
     struct node_lock_t {
         nodes_mutexes_t& mutexes;
         std::size_t slot;
-        inline ~node_lock_t() noexcept { mutexes.atomic_reset(slot); }
+        inline ~node_lock_t() noexcept { mutexes.unlock(slot); }
     };
 
     // standard hash function is the identity function.
@@ -327,6 +674,7 @@ class lantern_storage_gt {
     // objects to us, so we use a dummy lock here When allocating nodes ourselves, however, we do proper per=node
     // locking with a bitfield, identical to how upstream usearch storeage does it
     using lock_type = std::conditional_t<is_external_ak, dummy_lock, node_lock_t>;
+    using version_t = typename nodes_mutexes_t::version_t;
 
     bool reserve(std::size_t count) {
         if (loaded_ && retriever_ctx_ != nullptr && is_external_ak) {
@@ -334,7 +682,9 @@ class lantern_storage_gt {
             return true;
         }
 
-        if (count < nodes_.size() && count < nodes_mutexes_.size())
+        // vectors are checked as well, as loading a codebook may switch the storage into PQ mode
+        std::size_t const vectors_capacity = colocated_ ? count : (pq_ ? vectors_pq_ : vectors_).size();
+        if (count < nodes_.size() && count < nodes_mutexes_.size() && count <= vectors_capacity)
             return true;
         nodes_mutexes_t new_mutexes(count);
         nodes_t new_nodes(count);
@@ -345,7 +695,9 @@ class lantern_storage_gt {
 
         nodes_mutexes_ = std::move(new_mutexes);
         nodes_ = std::move(new_nodes);
-        if (pq_) {
+        if (colocated_) {
+            // vectors are stored in node blocks
+        } else if (pq_) {
             vectors_pq_.resize(count);
         } else {
             vectors_.resize(count);
@@ -354,7 +706,10 @@ class lantern_storage_gt {
         return true;
     }
     void clear() noexcept {
-        if (!is_immutable()) {
+        // arenas are released at once, without visiting every node and vector
+        if (use_arena_)
+            arena_.reset();
+        else if (!is_immutable()) {
             std::size_t n = nodes_.size();
             for (std::size_t i = 0; i != n; ++i) {
                 // we do not know which slots have been filled and which ones - no
@@ -386,13 +741,61 @@ class lantern_storage_gt {
     }
     void reset() noexcept { clear(); }
 
+    /**
+     *  Moves the node and the vector of the old slot `order[i]` into every slot `i` of the first @p count.
+     *  Co-located blocks in arena mode are also copied into a fresh arena in their new order, so that
+     *  nodes, which are close in that order, end up close in memory as well.
+     */
+    bool permute(compressed_slot_at const* order, std::size_t count) {
+        if (is_external_ak || is_immutable())
+            return false;
+        nodes_t new_nodes(nodes_.size());
+        if (!new_nodes)
+            return false;
+        std::memcpy(new_nodes.data(), nodes_.data(), sizeof(node_t) * nodes_.size());
+        for (std::size_t i = 0; i != count; ++i)
+            new_nodes[i] = nodes_[static_cast<std::size_t>(order[i])];
+
+        if (colocated_ && use_arena_) {
+            slab_allocator_gt<64> arena;
+            for (std::size_t i = 0; i != new_nodes.size(); ++i) {
+                if (!new_nodes[i])
+                    continue;
+                std::size_t block_size = block_size_bytes(new_nodes[i].node_size_bytes(pre_));
+                byte_t* tape = arena.allocate(block_size);
+                if (!tape)
+                    return false;
+                std::memcpy(tape, new_nodes[i].tape(), block_size);
+                new_nodes[i] = node_t{tape};
+            }
+            // the old arena is released, once it is swapped into the local one
+            arena_ = std::move(arena);
+        } else if (!colocated_) {
+            vectors_t& vectors = pq_ ? vectors_pq_ : vectors_;
+            vectors_t new_vectors(vectors);
+            for (std::size_t i = 0; i != count; ++i)
+                new_vectors[i] = vectors[static_cast<std::size_t>(order[i])];
+            vectors = std::move(new_vectors);
+        }
+        nodes_ = std::move(new_nodes);
+        return true;
+    }
+
+    /// Allocates a node tape. In co-located mode the vector is allocated with it, but the span only covers the node
     span_bytes_t node_malloc(level_t level) noexcept {
         std::size_t node_size = node_t::node_size_bytes(pre_, level);
-        byte_t* data = (byte_t*)allocator_.allocate(node_size);
+        std::size_t block_size = block_size_bytes(node_size);
+        byte_t* data = tape_allocate(block_size);
+        if (data && colocated_) {
+            std::size_t vector_offset = vector_offset_bytes(node_size);
+            std::size_t vector_end = vector_offset + stored_vector_size_bytes();
+            std::memcpy(data + node_size, padding_buffer, vector_offset - node_size);
+            std::memcpy(data + vector_end, padding_buffer, block_size - vector_end);
+        }
         return data ? span_bytes_t{data, node_size} : span_bytes_t{};
     }
     void node_free(size_t slot, node_t node) {
-        allocator_.deallocate(node.tape(), node.node_size_bytes(pre_));
+        tape_deallocate(node.tape(), block_size_bytes(node.node_size_bytes(pre_)));
         nodes_[slot] = node_t{};
     }
     node_t node_make(key_at key, level_t level) noexcept {
@@ -413,14 +816,48 @@ class lantern_storage_gt {
             return;
         nodes_[slot] = node;
     }
+    /**
+     *  @brief  Number of bytes a vector occupies once encoded by `encode_vectors`, or zero if vectors are
+     *          stored as they are. In PQ mode `set_vector_at` accepts vectors of this size, if they are
+     *          marked as already encoded.
+     */
+    std::size_t encoded_vector_bytes() const noexcept { return pq_ ? pq_codebook_.num_subvectors() : 0; }
+
+    /**
+     *  @brief  Encodes @p count full-precision vectors, located @p stride bytes apart, into
+     *          `encoded_vector_bytes()` bytes each, written contiguously into @p encoded.
+     */
+    void encode_vectors(const byte_t* vectors, std::size_t count, std::size_t stride, byte_t* encoded) const {
+        expect(pq_, "only product-quantized vectors need encoding");
+        pq_codebook_.compress_batch((const float*)vectors, count, stride, encoded);
+    }
+
+    /**
+     *  @param[in] encoded Whether @p vector_data was already encoded by `encode_vectors`, or read back from
+     *          a serialized PQ index. Only meaningful in PQ mode.
+     */
     void set_vector_at(uint64_t slot, const byte_t* vector_data, size_t vector_size, bool copy_vector,
-                       bool reuse_node) {
+                       bool reuse_node, bool encoded) {
+        encoded = encoded && pq_;
+        expect(!encoded || vector_size == encoded_vector_bytes(), "unexpected encoded vector size");
         if (loaded_ && is_external_ak) {
             assert(retriever_ctx_ != nullptr);
             char* tape = (char*)external_node_retriever_(retriever_ctx_, slot);
             node_t node{tape};
-            byte_t* vec_loc = tape + node.node_size_bytes(pre_);
-            if (pq_) {
+            byte_t* vec_loc = tape + vector_offset_bytes(node.node_size_bytes(pre_));
+            if (pq_ && !encoded) {
+                pq_codebook_.compress((const float*)vector_data, vec_loc);
+            } else {
+                std::memcpy(vec_loc, vector_data, vector_size);
+            }
+            return;
+        }
+
+        // co-located vectors are always copied into the block of their node, which is already stored
+        if (colocated_) {
+            expect(vector_size == (encoded ? encoded_vector_bytes() : vector_size_bytes_), "unexpected vector size");
+            byte_t* vec_loc = get_stored_vector_at(slot);
+            if (pq_ && !encoded) {
                 pq_codebook_.compress((const float*)vector_data, vec_loc);
             } else {
                 std::memcpy(vec_loc, vector_data, vector_size);
@@ -435,20 +872,24 @@ class lantern_storage_gt {
             if (!reuse_node) {
                 if (pq_) {
                     const size_t pq_size = pq_codebook_.num_subvectors();
-                    vectors_pq_[slot] = span_bytes_t{allocator_.allocate(pq_size), pq_size};
+                    vectors_pq_[slot] = span_bytes_t{tape_allocate(pq_size), pq_size};
                 } else {
-                    vectors_[slot] = span_bytes_t{allocator_.allocate(vector_size), vector_size};
+                    vectors_[slot] = span_bytes_t{tape_allocate(vector_size), vector_size};
                 }
             }
-            if (pq_) {
+            if (pq_ && !encoded) {
                 pq_codebook_.compress((const float*)vector_data, vectors_pq_[slot]);
+            } else if (pq_) {
+                std::memcpy(vectors_pq_[slot].data(), vector_data, vector_size);
             } else {
                 std::memcpy(vectors_[slot].data(), vector_data, vector_size);
             }
         } else {
-            if (pq_) {
+            if (pq_ && !encoded) {
                 // cannot avoid copy when doing pq quantization
                 expect(false);
+            } else if (pq_) {
+                vectors_pq_[slot] = span_bytes_t{(byte_t*)vector_data, vector_size};
             } else {
                 vectors_[slot] = span_bytes_t{(byte_t*)vector_data, vector_size};
             }
@@ -461,12 +902,25 @@ class lantern_storage_gt {
         if constexpr (is_external_ak) {
             return {};
         } else {
-            while (nodes_mutexes_.atomic_set(i))
-                ;
+            nodes_mutexes_.lock(i);
             return {nodes_mutexes_, i};
         }
     }
 
+    // external storage locks the nodes before passing them to us, so their reads never have to be retried
+    inline version_t node_read_begin(std::size_t i) const noexcept {
+        if constexpr (is_external_ak)
+            return 0;
+        else
+            return nodes_mutexes_.read_begin(i);
+    }
+    inline bool node_read_validate(std::size_t i, version_t version) const noexcept {
+        if constexpr (is_external_ak)
+            return true;
+        else
+            return nodes_mutexes_.read_validate(i, version);
+    }
+
     // serialization
 
     template <typename output_callback_at, typename vectors_metadata_at>
@@ -475,18 +929,69 @@ class lantern_storage_gt {
                                                   const vectors_metadata_at& metadata_buffer,
                                                   serialization_config_t config = {}) const {
         expect(!config.use_64_bit_dimensions, "64_bit dimensions not supported in lantern storage");
-        expect(output(metadata_buffer, sizeof(metadata_buffer)));
-
-        file_offset_ = sizeof(metadata_buffer);
         expect(vector_size_bytes_ == vector_size_bytes, "unexpected vector size bytes");
+
+        vectors_metadata_at head_buffer;
+        std::memcpy(head_buffer, metadata_buffer, sizeof(head_buffer));
+        codebook_section_t section{};
+        if (pq_ && !is_external_ak) {
+            section.version = codebook_section_version_k;
+            section.num_centroids = static_cast<std::uint16_t>(pq_codebook_.num_centroids());
+            section.num_subvectors = static_cast<std::uint32_t>(pq_codebook_.num_subvectors());
+            section.dimensions = pq_codebook_.dimensions();
+            std::memcpy(head_buffer + codebook_section_offset_k, &section, sizeof(section));
+        }
+        // the packed layout is described by the absence of the layout section, keeping such files unchanged
+        file_alignment_ = config.exclude_vectors ? 1 : vector_alignment();
+        if (file_alignment_ != 1) {
+            layout_section_t layout{};
+            layout.version = layout_section_version_k;
+            layout.vector_alignment = static_cast<std::uint16_t>(file_alignment_);
+            std::memcpy(head_buffer + layout_section_offset_k, &layout, sizeof(layout));
+        }
+        expect(output(head_buffer, sizeof(head_buffer)));
+        file_offset_ = sizeof(head_buffer);
+
+        if (section.version) {
+            std::size_t padding_size = codebook_padding(file_offset_);
+            expect(output(&padding_buffer, padding_size));
+            expect(output(pq_codebook_.get(0, 0).data(), section.tape_bytes()));
+            file_offset_ += padding_size + section.tape_bytes();
+        }
         node_count_ = node_count;
         exclude_vectors_ = config.exclude_vectors;
         return {};
     }
 
+    /**
+     *  With a @p permutation the nodes are written in its order, with their neighbors relabeled
+     *  on a copy, so that a saved file gets a locality-preserving layout, without changing the index.
+     */
     template <typename output_callback_at, typename progress_at = dummy_progress_t>
     serialization_result_t save_nodes_to_stream(output_callback_at& output, const index_serialized_header_t& header,
-                                                progress_at& = {}) const {
+                                                progress_at& = {},
+                                                slot_permutation_gt<compressed_slot_at> const* permutation = {}) const {
+        // external slots are addressed by the host, which doesn't expect them to move
+        if (permutation && is_external_ak)
+            return serialization_result_t{}.failed("Can't reorder an index in external storage");
+        // returns the node in the slot that goes to position `i` in the file, relabeled if needed
+        buffer_gt<byte_t> relabeled;
+        auto file_node = [&](std::size_t i, std::size_t& slot) -> node_t {
+            slot = permutation ? static_cast<std::size_t>(permutation->order[i]) : i;
+            node_t node = get_node_at(slot);
+            if (!permutation)
+                return node;
+            std::size_t node_size = node.node_size_bytes(pre_);
+            std::size_t copied_size = colocated_ ? block_size_bytes(node_size) : node_size;
+            if (relabeled.size() < copied_size)
+                relabeled = buffer_gt<byte_t>(copied_size);
+            expect(relabeled.size() >= copied_size, "out of memory, allocating the relabeling buffer");
+            std::memcpy(relabeled.data(), node.tape(), copied_size);
+            node = node_t{relabeled.data()};
+            node.relabel(pre_, permutation->labels.data());
+            return node;
+        };
+
         expect(output(&header, sizeof(header)));
         expect(output(&vector_size_bytes_, sizeof(vector_size_bytes_)));
         expect(output(&node_count_, sizeof(node_count_)));
@@ -499,9 +1004,22 @@ class lantern_storage_gt {
         // header This in upstream storage speeds up view()-ing index from disc, but that API is not relevant in lantern
         // and having level info here unnecessarily bloats our index, so we do not do it.
 
-        // After that dump the nodes themselves
+        // After that dump the nodes themselves, the first of them aligned like the rest
+        std::size_t padding_size = file_padding(file_offset_);
+        expect(output(&padding_buffer, padding_size));
+        file_offset_ += padding_size;
         for (std::size_t i = 0; i != header.size; ++i) {
-            span_bytes_t node_bytes = get_node_at(i).node_bytes(pre_);
+            std::size_t slot;
+            node_t node = file_node(i, slot);
+            // co-located blocks are laid out just like the file, including the trailing padding
+            if (colocated_ && !exclude_vectors_) {
+                std::size_t block_size = block_size_bytes(node.node_size_bytes(pre_));
+                expect(output(node.tape(), block_size));
+                file_offset_ += block_size;
+                continue;
+            }
+
+            span_bytes_t node_bytes = node.node_bytes(pre_);
             expect(output(node_bytes.data(), node_bytes.size()));
             // std::fprintf(stderr, "node %d level %d size %d offset %d\n", (int)i, (int)get_node_at(i).level(),
             //              (int)node_bytes.size(), (int)file_offset_);
@@ -509,13 +1027,16 @@ class lantern_storage_gt {
 
             if (!exclude_vectors_) {
                 // add padding for proper alignment
-                int16_t padding_size = align4(file_offset_);
+                padding_size = file_padding(file_offset_);
                 expect(output(&padding_buffer, padding_size));
                 file_offset_ += padding_size;
-                span_bytes_t vector_span = pq_ ? vectors_pq_[i] : vectors_[i];
+                span_bytes_t vector_span = pq_ ? vectors_pq_[slot] : vectors_[slot];
 
                 expect(output(vector_span.data(), vector_span.size()));
                 file_offset_ += vector_span.size();
+                padding_size = file_padding(file_offset_);
+                expect(output(&padding_buffer, padding_size));
+                file_offset_ += padding_size;
             }
         }
         return {};
@@ -529,6 +1050,23 @@ class lantern_storage_gt {
         expect(input(metadata_buffer, sizeof(metadata_buffer)));
         file_offset_ = sizeof(metadata_buffer);
         exclude_vectors_ = config.exclude_vectors;
+        read_layout_section(metadata_buffer);
+
+        codebook_section_t section = codebook_section(metadata_buffer);
+        if (section.version) {
+            byte_t in_padding_buffer[codebook_alignment_k] = {0};
+            std::size_t padding_size = codebook_padding(file_offset_);
+            expect(input(&in_padding_buffer, padding_size));
+            expect(std::memcmp(in_padding_buffer, padding_buffer, padding_size) == 0);
+
+            std::shared_ptr<float[]> tape(new (std::nothrow) float[section.tape_bytes() / sizeof(float)]);
+            if (!tape)
+                return serialization_result_t{}.failed("Out of memory, allocating the codebook");
+            expect(input(tape.get(), section.tape_bytes()));
+            file_offset_ += padding_size + section.tape_bytes();
+            use_codebook(tape.get(), section);
+            pq_codebook_tape_ = std::move(tape);
+        }
         return {};
     }
 
@@ -548,9 +1086,10 @@ class lantern_storage_gt {
             return {};
         byte_t in_padding_buffer[64] = {0};
 
-        // can support this once we start storing the codebook in the file header
-        expect(!pq_);
+        expect(!pq_ || pq_codebook_.dimensions() * sizeof(float) == vector_size_bytes_,
+               "codebook dimensions do not match the vectors");
         expect(reserve(header.size));
+        std::size_t const stored_vector_size = stored_vector_size_bytes();
 
         // N.B: unlike upstream usearch storage, lantern storage does not save level info of all nodes as part of the
         // header This in upstream storage speeds up view()-ing index from disc, but that API is not relevant in lantern
@@ -559,7 +1098,16 @@ class lantern_storage_gt {
         std::array<byte_t, node_t::head_size_bytes()> node_header;
         level_t extracted_node_level = -1;
 
+        auto skip_padding = [&] {
+            std::size_t padding_size = file_padding(file_offset_);
+            expect(input(&in_padding_buffer, padding_size));
+            expect(std::memcmp(in_padding_buffer, padding_buffer, padding_size) == 0);
+            file_offset_ += padding_size;
+        };
+
         // Load the nodes
+        if (!exclude_vectors_)
+            skip_padding();
         for (std::size_t i = 0; i != header.size; ++i) {
             // extract just the node header first, to know its level, then extract the rest
             expect(input(node_header.data(), node_header.size()));
@@ -573,14 +1121,13 @@ class lantern_storage_gt {
             file_offset_ += node_bytes.size();
             node_store(i, node_t{node_bytes.data()});
             if (!exclude_vectors_) {
-                int16_t padding_size = align4(file_offset_);
-                expect(input(&in_padding_buffer, padding_size));
-                file_offset_ += padding_size;
-                expect(std::memcmp(in_padding_buffer, padding_buffer, padding_size) == 0);
-                byte_t* vector_bytes = allocator_.allocate(vector_size_bytes_);
-                expect(input(vector_bytes, vector_size_bytes_));
-                file_offset_ += vector_size_bytes_;
-                set_vector_at(i, vector_bytes, vector_size_bytes_, false, false);
+                skip_padding();
+                byte_t* vector_bytes = colocated_ ? get_stored_vector_at(i) : tape_allocate(stored_vector_size);
+                expect(input(vector_bytes, stored_vector_size));
+                file_offset_ += stored_vector_size;
+                if (!colocated_)
+                    set_vector_at(i, vector_bytes, stored_vector_size, false, false, pq_);
+                skip_padding();
             }
         }
         return {};
@@ -597,11 +1144,29 @@ class lantern_storage_gt {
         reset();
         exclude_vectors_ = config.exclude_vectors;
         expect(!config.use_64_bit_dimensions);
+        // co-located vectors would be written right into the viewed file, after their nodes
+        if (colocated_ && exclude_vectors_)
+            return serialization_result_t{}.failed("cannot view co-located nodes without their vectors");
 
         expect(bool(file.open_if_not()));
         std::memcpy(metadata_buffer, file.data() + offset, sizeof(metadata_buffer));
         file_offset_ = sizeof(metadata_buffer);
         offset += sizeof(metadata_buffer);
+        read_layout_section(metadata_buffer);
+
+        // The codebook is used right from the mapped file, without copies or decoding
+        codebook_section_t section = codebook_section(metadata_buffer);
+        if (section.version) {
+            std::size_t padding_size = codebook_padding(file_offset_);
+            if (offset + padding_size + section.tape_bytes() > file.size())
+                return serialization_result_t{}.failed("File is too small to contain the codebook");
+            expect(std::memcmp(file.data() + offset, padding_buffer, padding_size) == 0);
+            offset += padding_size;
+            pq_codebook_tape_.reset();
+            use_codebook(reinterpret_cast<float const*>(file.data() + offset), section);
+            offset += section.tape_bytes();
+            file_offset_ += padding_size + section.tape_bytes();
+        }
         return {};
     }
 
@@ -612,6 +1177,8 @@ class lantern_storage_gt {
             return serialization_result_t{}.failed("cannot view vectors when storage is external");
         }
         serialization_result_t result = file.open_if_not();
+        // the layout is aligned relative to the start of the index, rather than the file
+        std::size_t const index_offset = offset - file_offset_;
         std::memcpy(&header, file.data() + offset, sizeof(header));
         offset += sizeof(header);
         std::memcpy(&vector_size_bytes_, file.data() + offset, sizeof(vector_size_bytes_));
@@ -626,39 +1193,38 @@ class lantern_storage_gt {
         config.connectivity = header.connectivity;
         config.connectivity_base = header.connectivity_base;
         pre_ = node_t::precompute_(config);
-        buffer_gt<std::size_t> offsets(header.size);
-        expect(offsets);
 
+        expect(!pq_ || pq_codebook_.dimensions() * sizeof(float) == vector_size_bytes_,
+               "codebook dimensions do not match the vectors");
+        // vectors of files with another layout can't be found from their nodes, so they are recorded separately
+        if (colocated_ && !exclude_vectors_ && file_alignment_ != vector_alignment())
+            colocated_ = false;
         expect(reserve(header.size));
+        std::size_t const stored_vector_size = stored_vector_size_bytes();
         // N.B: unlike upstream usearch storage, lantern storage does not save level info of all nodes as part of the
         // header This in upstream storage speeds up view()-ing index from disc, but that API is not relevant in lantern
         // and having level info here unnecessarily bloats our index, so we do not do it.
 
-        offsets[0u] = offset;
+        auto skip_padding = [&] {
+            std::size_t padding_size = file_padding(offset - index_offset);
+            expect(std::memcmp(file.data() + offset, padding_buffer, padding_size) == 0);
+            offset += padding_size;
+        };
 
         // Rapidly address all the nodes and vectors
+        if (!exclude_vectors_)
+            skip_padding();
         for (std::size_t i = 0; i != header.size; ++i) {
-            // offset of 0th is already above, offset of each next one comes from the node before
-            if (i > 0) {
-                offsets[i] = offsets[i - 1] + get_node_at(i - 1).node_size_bytes(pre_);
-                // node_t::node_size_bytes(pre_, levels[i - 1]);
-                if (!exclude_vectors_) {
-                    // add room for vector alignment
-                    offsets[i] += align4(offsets[i]);
-                    offsets[i] += vector_size_bytes_;
-                }
-            }
-            node_store(i, node_t{file.data() + offsets[i]});
+            node_store(i, node_t{file.data() + offset});
+            offset += node_size_bytes(i);
 
             if (!exclude_vectors_) {
-                size_t vector_offset = offsets[i] + node_size_bytes(i);
-                expect(std::memcmp(file.data() + vector_offset, padding_buffer, align4(vector_offset)) == 0);
-                vector_offset += align4(vector_offset);
-
-                // expect proper alignment
-                expect(align4(vector_offset) == 0);
-                expect(align4(file.data() + vector_offset) == 0);
-                set_vector_at(i, file.data() + vector_offset, vector_size_bytes_, false, false);
+                skip_padding();
+                // viewed blocks share the co-located layout, so their vectors are found without being recorded
+                if (!colocated_)
+                    set_vector_at(i, file.data() + offset, stored_vector_size, false, false, pq_);
+                offset += stored_vector_size;
+                skip_padding();
             }
         }
         viewed_file_ = std::move(file);
@@ -666,6 +1232,181 @@ class lantern_storage_gt {
     }
 };
 
+/**
+ *  @brief  Configuration options for `train_pq_codebook`.
+ */
+struct pq_training_config_t {
+    /// @brief Number of vectors sampled for every mini-batch k-means iteration.
+    std::size_t batch_size = 4096;
+    /// @brief Upper bound on the number of mini-batch iterations per subspace.
+    std::size_t max_iterations = 256;
+    /// @brief Minimal relative improvement of the smoothed mini-batch inertia, to consider an iteration useful.
+    float tolerance = 1e-3f;
+    /// @brief Number of consecutive useless iterations, after which the training of a subspace stops.
+    std::size_t patience = 16;
+    /// @brief Seed for sampling, making the training deterministic for the same inputs.
+    std::uint64_t seed = 42;
+};
+
+struct pq_training_result_t {
+    error_t error{};
+    /// @brief Number of mini-batch iterations performed across all subspaces.
+    std::size_t iterations{};
+
+    explicit operator bool() const noexcept { return !error; }
+    pq_training_result_t failed(error_t message) noexcept {
+        error = std::move(message);
+        return std::move(*this);
+    }
+};
+
+/**
+ *  @brief  Trains a product quantization codebook, running mini-batch k-means with k-means++ initialization
+ *          independently in every subspace. The output tape has `num_centroids` rows of `dimensions` floats,
+ *          the layout `lantern_storage_gt` expects for its codebook.
+ *
+ *  With at least as many subspaces as threads, subspaces are trained in parallel. Otherwise they are trained
+ *  one after another, assigning every mini-batch to the closest centroids in parallel.
+ *
+ *  @param[in] vectors Training sample of `count` contiguous vectors of `dimensions` floats each.
+ *  @param[out] codebook Output tape of `num_centroids * dimensions` floats.
+ *  @param[in] progress Callback receiving the number of trained and total subspaces, returning `false` to stop.
+ */
+template <typename executor_at = executor_default_t, typename progress_at = dummy_progress_t>
+pq_training_result_t train_pq_codebook(                                             //
+    float const* vectors, std::size_t count, std::size_t dimensions,                 //
+    std::size_t num_centroids, std::size_t num_subvectors, float* codebook,          //
+    pq_training_config_t config = {},                                                //
+    executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}) { //
+
+    pq_training_result_t result;
+    if (!vectors || !codebook)
+        return result.failed("Training vectors and codebook output are required");
+    if (!num_centroids || num_centroids > 256)
+        return result.failed("Number of centroids must be between 1 and 256");
+    if (!num_subvectors || dimensions % num_subvectors)
+        return result.failed("Vector dimensions must be divisible to num_subvectors");
+    if (count < num_centroids)
+        return result.failed("Need at least as many training vectors as centroids");
+
+    std::size_t const subvector_dim = dimensions / num_subvectors;
+    std::size_t const batch_size = (std::min)(config.batch_size ? config.batch_size : count, count);
+    std::size_t const init_size = (std::min)(count, (std::max)(batch_size, 3 * num_centroids));
+    // Weight of a mini-batch in the exponentially smoothed inertia, same as in scikit-learn
+    float const smoothing = (std::min)(1.f, 2.f * batch_size / (count + 1));
+    metric_l2sq_gt<float> l2sq;
+
+    auto train_subspace = [&](std::size_t subvector_id, auto&& subspace_executor) -> std::size_t {
+        std::size_t const offset = subvector_id * subvector_dim;
+        auto point = [&](std::size_t i) { return vectors + i * dimensions + offset; };
+        auto centroid = [&](std::size_t c) { return codebook + c * dimensions + offset; };
+
+        buffer_gt<std::size_t> sample(init_size);
+        buffer_gt<float> min_distances(init_size);
+        buffer_gt<std::size_t> counts(num_centroids);
+        buffer_gt<std::size_t> batch(batch_size);
+        buffer_gt<std::uint32_t> labels(batch_size);
+        buffer_gt<float> distances(batch_size);
+        if (!sample || !min_distances || !counts || !batch || !labels || !distances)
+            return std::numeric_limits<std::size_t>::max();
+
+        std::mt19937_64 generator(config.seed + subvector_id);
+        std::uniform_int_distribution<std::size_t> any_point(0, count - 1);
+
+        // k-means++ initialization over a random sample: every next centroid is picked
+        // with probability proportional to the squared distance to the closest one chosen so far
+        for (std::size_t i = 0; i != init_size; ++i)
+            sample[i] = init_size == count ? i : any_point(generator);
+        std::memcpy(centroid(0), point(sample[any_point(generator) % init_size]), subvector_dim * sizeof(float));
+        for (std::size_t i = 0; i != init_size; ++i)
+            min_distances[i] = l2sq(point(sample[i]), centroid(0), subvector_dim);
+        for (std::size_t c = 1; c != num_centroids; ++c) {
+            double total = 0;
+            for (std::size_t i = 0; i != init_size; ++i)
+                total += min_distances[i];
+            std::size_t chosen = any_point(generator) % init_size;
+            if (total > 0) {
+                double threshold = std::uniform_real_distribution<double>(0, total)(generator);
+                for (chosen = 0; chosen + 1 < init_size && threshold >= min_distances[chosen]; ++chosen)
+                    threshold -= min_distances[chosen];
+            }
+            std::memcpy(centroid(c), point(sample[chosen]), subvector_dim * sizeof(float));
+            for (std::size_t i = 0; i != init_size; ++i)
+                min_distances[i] = (std::min)(min_distances[i], l2sq(point(sample[i]), centroid(c), subvector_dim));
+        }
+
+        // Mini-batch iterations, moving every centroid towards its points with a decaying per-centroid rate
+        std::fill(counts.begin(), counts.end(), 0);
+        float smoothed_inertia = 0, best_inertia = std::numeric_limits<float>::max();
+        std::size_t iterations = 0, useless_iterations = 0;
+        while (iterations != config.max_iterations && useless_iterations != config.patience) {
+            for (std::size_t i = 0; i != batch_size; ++i)
+                batch[i] = batch_size == count ? i : any_point(generator);
+
+            subspace_executor.fixed(batch_size, [&](std::size_t, std::size_t i) {
+                float const* x = point(batch[i]);
+                float closest_distance = std::numeric_limits<float>::max();
+                std::uint32_t closest = 0;
+                for (std::size_t c = 0; c != num_centroids; ++c) {
+                    float distance = l2sq(x, centroid(c), subvector_dim);
+                    if (distance < closest_distance)
+                        closest_distance = distance, closest = static_cast<std::uint32_t>(c);
+                }
+                distances[i] = closest_distance;
+                labels[i] = closest;
+            });
+
+            float inertia = 0;
+            for (std::size_t i = 0; i != batch_size; ++i) {
+                float const* x = point(batch[i]);
+                float* y = centroid(labels[i]);
+                float rate = 1.f / ++counts[labels[i]];
+                for (std::size_t j = 0; j != subvector_dim; ++j)
+                    y[j] += (x[j] - y[j]) * rate;
+                inertia += distances[i] / batch_size;
+            }
+
+            smoothed_inertia = iterations ? smoothed_inertia * (1 - smoothing) + inertia * smoothing : inertia;
+            if (smoothed_inertia < best_inertia * (1 - config.tolerance))
+                best_inertia = smoothed_inertia, useless_iterations = 0;
+            else
+                ++useless_iterations;
+            ++iterations;
+        }
+        return iterations;
+    };
+
+    std::atomic<std::size_t> trained{0};
+    std::atomic<std::size_t> iterations{0};
+    std::atomic<bool> failed{false};
+    auto on_trained = [&](std::size_t thread_idx, std::size_t subspace_iterations) {
+        if (subspace_iterations == std::numeric_limits<std::size_t>::max())
+            return !(failed = true);
+        iterations += subspace_iterations;
+        ++trained;
+        // It's more efficient in this case to report progress from a single thread
+        return thread_idx != 0 || progress(trained.load(), num_subvectors);
+    };
+
+    if (num_subvectors >= executor.size()) {
+        executor.dynamic(num_subvectors, [&](std::size_t thread_idx, std::size_t subvector_id) {
+            return on_trained(thread_idx, train_subspace(subvector_id, dummy_executor_t{}));
+        });
+    } else {
+        for (std::size_t subvector_id = 0; subvector_id != num_subvectors; ++subvector_id)
+            if (!on_trained(0, train_subspace(subvector_id, executor)))
+                break;
+    }
+
+    result.iterations = iterations.load();
+    if (failed)
+        return result.failed("Out of memory!");
+    if (trained.load() != num_subvectors)
+        return result.failed("Training was interrupted");
+    progress(num_subvectors, num_subvectors);
+    return result;
+}
+
 template <typename key_at, typename compressed_slot_at, typename allocator_at = aligned_allocator_gt<byte_t, 64>>
 using lantern_storage_at = lantern_storage_gt<false, key_at, compressed_slot_at, allocator_at>;
 
@@ -176,6 +176,8 @@ struct index_dense_serialization_config_t {
     // We may not want to fetch the vectors from the same file, or allow attaching them afterwards
     bool exclude_vectors = false;
     bool use_64_bit_dimensions = false;
+    // Write the nodes in a locality-preserving order, see `index_gt::locality_order`, leaving the index unchanged
+    bool reorder = false;
 };
 
 using serialization_config_t = index_dense_serialization_config_t;
@@ -186,6 +188,10 @@ struct storage_options {
     bool pq;
     size_t num_centroids;
     size_t num_subvectors;
+    /// Allocate nodes and vectors from large arenas, released at once, rather than one by one
+    bool arena = false;
+    /// Allocate every vector in one block with its node, rather than separately
+    bool colocated = false;
 };
 /**
  * @brief The macro takes in a usearch Storage-provider type, and makes sure the type provides the necessary interface
@@ -197,8 +203,13 @@ struct storage_options {
     ASSERT_HAS_CONST_FUNCTION(CHECK_AT, get_node_at, CHECK_AT::node_t(std::size_t idx));                               \
     ASSERT_HAS_CONST_FUNCTION(CHECK_AT, get_node_at_mut, CHECK_AT::node_t(std::size_t idx));                               \
     ASSERT_HAS_CONST_FUNCTION(CHECK_AT, get_vector_at, byte_t*(std::size_t idx));                                      \
+    ASSERT_HAS_CONST_NOEXCEPT_FUNCTION(CHECK_AT, get_stored_vector_at, byte_t*(std::size_t idx));                      \
+    ASSERT_HAS_CONST_NOEXCEPT_FUNCTION(CHECK_AT, stored_vector_size_bytes, std::size_t());                             \
+    ASSERT_HAS_CONST_NOEXCEPT_FUNCTION(CHECK_AT, decode_vector, byte_t const*(byte_t const* stored, byte_t* dst));     \
     ASSERT_HAS_CONST_FUNCTION(CHECK_AT, node_size_bytes, std::size_t(std::size_t idx));                                \
+    ASSERT_HAS_CONST_NOEXCEPT_FUNCTION(CHECK_AT, prefetch, void(std::uint64_t const* slots, std::size_t count));       \
     ASSERT_HAS_CONST_NOEXCEPT_FUNCTION(CHECK_AT, is_immutable, bool());                                                \
+    ASSERT_HAS_CONST_NOEXCEPT_FUNCTION(CHECK_AT, serialized_overhead, std::size_t(std::size_t, bool));                 \
                                                                                                                        \
     /*Container methods */                                                                                             \
     ASSERT_HAS_FUNCTION(CHECK_AT, reserve, bool(std::size_t count));                                                   \
@@ -211,9 +222,24 @@ struct storage_options {
     ASSERT_HAS_FUNCTION(CHECK_AT, node_store, void(std::size_t slot, CHECK_AT::node_t node));                          \
     ASSERT_HAS_FUNCTION(CHECK_AT, set_vector_at,                                                                       \
                         void(std::size_t idx, const byte_t* vector_data, std::size_t vector_bytes, bool copy_vector,   \
-                             bool reuse_node));                                                                        \
+                             bool reuse_node, bool encoded));                                                          \
+    /*Quantization*/                                                                                                   \
+    ASSERT_HAS_CONST_NOEXCEPT_FUNCTION(CHECK_AT, encoded_vector_bytes, std::size_t());                                 \
+    ASSERT_HAS_CONST_FUNCTION(CHECK_AT, encode_vectors,                                                                \
+                              void(const byte_t* vectors, std::size_t count, std::size_t stride, byte_t* encoded));    \
+    /*Quantized (ADC) distances*/                                                                                      \
+    ASSERT_HAS_CONST_NOEXCEPT_FUNCTION(CHECK_AT, lookup_table_size, std::size_t());                                    \
+    ASSERT_HAS_CONST_NOEXCEPT_FUNCTION(CHECK_AT, lookup_table,                                                         \
+                                       bool(const byte_t* query, metric_kind_t metric, float* table));                 \
+    ASSERT_HAS_CONST_NOEXCEPT_FUNCTION(CHECK_AT, lookup_distance,                                                      \
+                                       float(const float* table, metric_kind_t metric, std::size_t idx));              \
+    ASSERT_HAS_CONST_NOEXCEPT_FUNCTION(CHECK_AT, lookup_stored_distance,                                               \
+                                       float(const float* table, metric_kind_t metric, const byte_t* stored));         \
     /*Locking*/                                                                                                        \
     ASSERT_HAS_CONST_NOEXCEPT_FUNCTION(CHECK_AT, node_lock, CHECK_AT::lock_type(std::size_t idx));                     \
+    ASSERT_HAS_CONST_NOEXCEPT_FUNCTION(CHECK_AT, node_read_begin, CHECK_AT::version_t(std::size_t idx));               \
+    ASSERT_HAS_CONST_NOEXCEPT_FUNCTION(CHECK_AT, node_read_validate,                                                   \
+                                       bool(std::size_t idx, CHECK_AT::version_t version));                            \
     /*Save/Restore API enforcement*/                                                                                   \
     ASSERT_HAS_FUNCTION(CHECK_AT, save_vectors_to_stream,                                                              \
                         serialization_result_t(                                                                        \
@@ -265,6 +291,11 @@ class storage_interface {
     // I currently enforice it via macros
     constexpr inline lock_type node_lock(std::size_t slot) const noexcept;
 
+    // Lock-free reads of the nodes, validated against the versions of their locks
+    using version_t = std::uint32_t;
+    inline version_t node_read_begin(std::size_t slot) const noexcept;
+    inline bool node_read_validate(std::size_t slot, version_t version) const noexcept;
+
     virtual inline node_t get_node_at(std::size_t idx) const noexcept = 0;
     virtual inline std::size_t node_size_bytes(std::size_t idx) const noexcept = 0;
     virtual inline byte_t* get_vector_at(std::size_t idx) const noexcept = 0;
@@ -331,7 +362,7 @@ class storage_v2_at {
     using storage_metadata_t = storage_metadata;
 
   private:
-    using nodes_mutexes_t = bitset_gt<dynamic_allocator_at>;
+    using nodes_mutexes_t = seqlocks_gt<dynamic_allocator_at>;
     using dynamic_allocator_traits_t = std::allocator_traits<dynamic_allocator_at>;
     using levels_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<level_t>;
     using nodes_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<node_t>;
@@ -362,6 +393,8 @@ class storage_v2_at {
 
     std::uint64_t matrix_rows_ = 0;
     std::uint64_t matrix_cols_ = 0;
+    /// @brief Size of the last added vector, to know how much of it to prefetch.
+    std::size_t vector_bytes_ = 0;
     bool vectors_loaded_{};
     memory_mapped_file_t viewed_file_{};
     using tape_allocator_traits_t = std::allocator_traits<tape_allocator_at>;
@@ -372,11 +405,12 @@ class storage_v2_at {
     struct node_lock_t {
         nodes_mutexes_t& mutexes;
         std::size_t slot;
-        inline ~node_lock_t() noexcept { mutexes.atomic_reset(slot); }
+        inline ~node_lock_t() noexcept { mutexes.unlock(slot); }
     };
 
   public:
     using node_retriever_t = void*;
+    using node_retriever_batch_t = void*;
     // constructor with same API as the one from lantern storage to make sure tests and benchmarks compile
     storage_v2_at(storage_options, index_config_t config, const float* = nullptr, tape_allocator_at tape_allocator = {})
         : storage_v2_at(config, tape_allocator) {}
@@ -387,15 +421,23 @@ class storage_v2_at {
     inline node_t get_node_at(std::size_t idx) const noexcept { return nodes_[idx]; }
     inline node_t get_node_at_mut(std::size_t idx) const noexcept { return nodes_[idx]; }
     // todo:: most of the time this is called for const* vector, maybe add a separate interface for const?
+    /// Vectors are stored uncompressed, so the optional decompression buffer @p dst is never needed
     inline byte_t* get_vector_at(std::size_t idx, byte_t* dst = nullptr) const noexcept {
-        assert(dst == nullptr);
         (void)dst;
         return vectors_lookup_[idx];
     }
+    inline byte_t* get_stored_vector_at(std::size_t idx) const noexcept { return vectors_lookup_[idx]; }
+    inline byte_t const* decode_vector(byte_t const* stored, byte_t*) const noexcept { return stored; }
+    std::size_t stored_vector_size_bytes() const noexcept {
+        return vector_bytes_ ? vector_bytes_ : static_cast<std::size_t>(matrix_cols_);
+    }
     inline void set_vector_at(std::size_t idx, const byte_t* vector_data, std::size_t bytes_per_vector,
-                              bool copy_vector, bool reuse_node) {
+                              bool copy_vector, bool reuse_node, bool encoded) {
         usearch_assert_m(!(reuse_node && !copy_vector),
                          "Cannot reuse node when not copying as there is no allocation needed");
+        usearch_assert_m(!encoded, "Vectors are stored uncompressed and never come in encoded");
+        (void)encoded;
+        vector_bytes_ = bytes_per_vector;
         if (copy_vector) {
             if (!reuse_node)
                 vectors_lookup_[idx] = vectors_allocator_.allocate(bytes_per_vector);
@@ -408,10 +450,31 @@ class storage_v2_at {
                             node_retriever_t external_node_retriever_mut) {
         assert(false);
     }
+    void set_node_retriever_batch(node_retriever_batch_t external_node_retriever_batch) { assert(false); }
 
     inline size_t node_size_bytes(std::size_t idx) const noexcept { return get_node_at(idx).node_size_bytes(pre_); }
     bool is_immutable() const noexcept { return bool(viewed_file_); }
+    /// Vectors are written right after the nodes, without any extra sections or paddings
+    std::size_t serialized_overhead(std::size_t, bool) const noexcept { return 0; }
     storage_metadata_t metadata() { return {}; }
+
+    /// Pulls the heads of node tapes and the whole vectors of the given slots into the CPU caches
+    void prefetch(std::uint64_t const* slots, std::size_t count) const noexcept {
+        std::size_t vector_bytes = stored_vector_size_bytes();
+        for (std::size_t i = 0; i != count; ++i) {
+            prefetch_m(nodes_[slots[i]].tape());
+            prefetch_bytes(vectors_lookup_[slots[i]], vector_bytes);
+        }
+    }
+
+    /// Vectors are stored uncompressed, so there is nothing to encode and no lookup tables to score against
+    std::size_t encoded_vector_bytes() const noexcept { return 0; }
+    void encode_vectors(const byte_t*, std::size_t, std::size_t, byte_t*) const {}
+    std::size_t lookup_table_size() const noexcept { return 0; }
+    bool lookup_table(const byte_t*, metric_kind_t, float*) const noexcept { return false; }
+    float lookup_distance(const float*, metric_kind_t, std::size_t) const noexcept { return 0; }
+    float lookup_stored_distance(const float*, metric_kind_t, const byte_t*) const noexcept { return 0; }
+
     struct hash_seq_gt {
         std::size_t operator()(compressed_slot_at const& element) const noexcept {
             return std::hash<std::size_t>{}(element);
@@ -421,6 +484,7 @@ class storage_v2_at {
     using compressed_slot_hasher = hash_seq_gt;
 
     using lock_type = node_lock_t;
+    using version_t = typename nodes_mutexes_t::version_t;
 
     bool reserve(std::size_t count) {
         if (count < nodes_.size() && count < nodes_mutexes_.size())
@@ -466,6 +530,24 @@ class storage_v2_at {
         viewed_file_ = {};
     }
 
+    /// Moves the node and the vector of the old slot `order[i]` into every slot `i` of the first @p count
+    bool permute(compressed_slot_at const* order, std::size_t count) {
+        if (is_immutable())
+            return false;
+        nodes_t new_nodes(nodes_.size());
+        if (!new_nodes)
+            return false;
+        vectors_t new_vectors(vectors_lookup_);
+        std::memcpy(new_nodes.data(), nodes_.data(), sizeof(node_t) * nodes_.size());
+        for (std::size_t i = 0; i != count; ++i) {
+            new_nodes[i] = nodes_[static_cast<std::size_t>(order[i])];
+            new_vectors[i] = vectors_lookup_[static_cast<std::size_t>(order[i])];
+        }
+        nodes_ = std::move(new_nodes);
+        vectors_lookup_ = std::move(new_vectors);
+        return true;
+    }
+
     void reset() noexcept {
         nodes_mutexes_ = {};
         nodes_ = {};
@@ -508,12 +590,14 @@ class storage_v2_at {
 
     void node_store(size_t slot, node_t node) noexcept { nodes_[slot] = node; }
     tape_allocator_at const& node_allocator() const noexcept { return tape_allocator_; }
-    // dummy lock just to satisfy the interface
     constexpr inline lock_type node_lock(std::size_t slot) const noexcept {
-        while (nodes_mutexes_.atomic_set(slot))
-            ;
+        nodes_mutexes_.lock(slot);
         return {nodes_mutexes_, slot};
     }
+    inline version_t node_read_begin(std::size_t slot) const noexcept { return nodes_mutexes_.read_begin(slot); }
+    inline bool node_read_validate(std::size_t slot, version_t version) const noexcept {
+        return nodes_mutexes_.read_validate(slot, version);
+    }
 
 #pragma region Storage Serialization and Deserialization
 
@@ -574,9 +658,13 @@ class storage_v2_at {
      */
     template <typename output_callback_at, typename progress_at = dummy_progress_t>
     serialization_result_t save_nodes_to_stream(output_callback_at& output, const index_serialized_header_t& header,
-                                                progress_at& progress = {}) const {
+                                                progress_at& progress = {},
+                                                slot_permutation_gt<compressed_slot_at> const* permutation = {}) const {
 
         serialization_result_t result;
+        // The vectors are serialized separately, before the nodes, in the order of the slots
+        if (permutation)
+            return result.failed("Reordering on save is not supported, reorder() the index before saving it");
 
         if (!output(&header, sizeof(header)))
             return result.failed("Failed to serialize the header into stream");
@@ -770,7 +858,7 @@ class storage_v2_at {
         if (!config.exclude_vectors)
             for (std::uint64_t slot = 0; slot != matrix_rows; ++slot)
                 set_vector_at(slot, vectors_buffer.data() + matrix_cols * slot, matrix_cols, //
-                              false, false);
+                              false, false, false);
 
         if (file.size() - offset < sizeof(metadata_buffer))
             return result.failed("File is corrupted and lacks a header");
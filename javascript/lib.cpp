@@ -181,6 +181,12 @@ Napi::Value CompiledIndex::Search(Napi::CallbackInfo const& ctx) {
     std::size_t tasks = queries.ElementLength() / native_->dimensions();
     std::size_t wanted = napi_argument_to_size(ctx[1]);
 
+    // Per-call overrides, leaving the shared index config untouched
+    index_search_config_t config;
+    config.expansion = napi_argument_to_size(ctx[2]);
+    config.exact = ctx[3].As<Napi::Boolean>().Value();
+    config.radius = ctx[4].As<Napi::Number>().DoubleValue();
+
     auto run_parallel = [&](auto vectors) -> Napi::Value {
         Napi::Array result_js = Napi::Array::New(env, 3);
         Napi::BigUint64Array matches_js = Napi::BigUint64Array::New(env, tasks * wanted);
@@ -195,7 +201,7 @@ Napi::Value CompiledIndex::Search(Napi::CallbackInfo const& ctx) {
             bool failed = false;
             executor_stl_t executor;
             executor.fixed(tasks, [&](std::size_t /*thread_idx*/, std::size_t task_idx) {
-                auto result = native_->search(vectors + task_idx * native_->dimensions(), wanted);
+                auto result = native_->search(vectors + task_idx * native_->dimensions(), wanted, config);
                 if (!result) {
                     failed = true;
                     Napi::TypeError::New(env, result.error.release()).ThrowAsJavaScriptException();
@@ -233,19 +233,23 @@ class Index {
      * 
      * @param {Float32Array|Float64Array|Int8Array|Array<Array<number>>} vectors - Input matrix representing query vectors, can be a TypedArray or an array of arrays.
      * @param {number} k - The number of nearest neighbors to search for each query vector.
+     * @param {{expansion: number = 0, exact: boolean = false, radius: number = Infinity}} [config] - Optional overrides for this search only: the expansion factor, with 0 using the `expansion_search` of the index, exhaustive search, and the upper bound on the distance to matches.
      * @return {Matches|BatchMatches} - Search results for one or more queries, containing keys, distances, and counts of the matches found.
      * @throws Will throw an error if `k` is not a positive integer or if the size of the vectors is not a multiple of dimensions.
      * @throws Will throw an error if `vectors` is not a valid input type (TypedArray or an array of arrays) or if its flattened size is not a multiple of dimensions.
      */
-    search(vectors, k) {
+    search(vectors, k, { expansion = 0, exact = false, radius = Infinity } = {}) {
         if ((!Number.isNaN(k) && typeof k !== 'number') || k <= 0) {
             throw new Error("`k` must be a positive integer representing the number of nearest neighbors to search for.");
         }
+        if (!Number.isInteger(expansion) || expansion < 0) {
+            throw new Error("`expansion` must be a non-negative integer.");
+        }
 
         const normalizedVectors = normalizeVectors(vectors, this._compiledIndex.dimensions());
 
         // Call the compiled method and create Matches or BatchMatches object with the result
-        const result = this._compiledIndex.search(normalizedVectors, k);
+        const result = this._compiledIndex.search(normalizedVectors, k, expansion, Boolean(exact), Number.isFinite(radius) ? radius : Number.MAX_VALUE);
         const countInQueries = normalizedVectors.length / Number(this._compiledIndex.dimensions());
         const batchMatches = new BatchMatches(result[0], result[1], result[2], k);
 
@@ -246,9 +246,9 @@ static void add_many_to_index(                            //
 }
 
 template <typename scalar_at>
-static void search_typed(                                   //
-    dense_index_py_t& index, py::buffer_info& vectors_info, //
-    std::size_t wanted, bool exact, std::size_t threads,    //
+static void search_typed(                                                  //
+    dense_index_py_t& index, py::buffer_info& vectors_info,                //
+    std::size_t wanted, index_search_config_t config, std::size_t threads, //
     py::array_t<dense_key_t>& keys_py, py::array_t<distance_t>& distances_py, py::array_t<Py_ssize_t>& counts_py,
     std::atomic<std::size_t>& stats_visited_members, std::atomic<std::size_t>& stats_computed_distances,
     progress_func_t const& progress) {
@@ -272,7 +272,7 @@ static void search_typed(                                   //
     atomic_error_t atomic_error{nullptr};
     executor_default_t{threads}.dynamic(vectors_count, [&](std::size_t thread_idx, std::size_t task_idx) {
         scalar_at const* vector = (scalar_at const*)(vectors_data + task_idx * vectors_info.strides[0]);
-        dense_search_result_t result = index.search(vector, wanted, thread_idx, exact);
+        dense_search_result_t result = index.search(vector, wanted, config, thread_idx);
         if (!result) {
             atomic_error = result.error.release();
             return false;
@@ -306,9 +306,9 @@ static void search_typed(                                   //
 }
 
 template <typename scalar_at>
-static void search_typed(                                       //
-    dense_indexes_py_t& indexes, py::buffer_info& vectors_info, //
-    std::size_t wanted, bool exact, std::size_t threads,        //
+static void search_typed(                                                  //
+    dense_indexes_py_t& indexes, py::buffer_info& vectors_info,            //
+    std::size_t wanted, index_search_config_t config, std::size_t threads, //
     py::array_t<dense_key_t>& keys_py, py::array_t<distance_t>& distances_py, py::array_t<Py_ssize_t>& counts_py,
     std::atomic<std::size_t>& stats_visited_members, std::atomic<std::size_t>& stats_computed_distances,
     progress_func_t const& progress) {
@@ -348,7 +348,7 @@ static void search_typed(                                       //
 
         for (std::size_t vector_idx = 0; vector_idx != static_cast<std::size_t>(vectors_count); ++vector_idx) {
             scalar_at const* vector = (scalar_at const*)(vectors_data + vector_idx * vectors_info.strides[0]);
-            dense_search_result_t result = index.search(vector, wanted, 0, exact);
+            dense_search_result_t result = index.search(vector, wanted, config, 0);
             if (!result) {
                 atomic_error = result.error.release();
                 return false;
@@ -402,11 +402,17 @@ static void search_typed(                                       //
 template <typename index_at>
 static py::tuple search_many_in_index( //
     index_at& index, py::buffer vectors, std::size_t wanted, bool exact, std::size_t threads,
-    progress_func_t const& progress) {
+    progress_func_t const& progress, std::size_t expansion, double radius) {
 
     if (wanted == 0)
         return py::tuple(5);
 
+    // Zero expansion makes every index fall back to its own `expansion_search`
+    index_search_config_t config;
+    config.expansion = expansion;
+    config.exact = exact;
+    config.radius = radius;
+
     if (index.limits().threads_search < threads)
         throw std::invalid_argument("Can't use that many threads!");
 
@@ -427,11 +433,11 @@ static py::tuple search_many_in_index( //
 
     // clang-format off
     switch (numpy_string_to_kind(vectors_info.format)) {
-    case scalar_kind_t::b1x8_k: search_typed<b1x8_t>(index, vectors_info, wanted, exact, threads, keys_py, distances_py, counts_py, stats_visited_members, stats_computed_distances, progress); break;
-    case scalar_kind_t::i8_k: search_typed<i8_t>(index, vectors_info, wanted, exact, threads, keys_py, distances_py, counts_py, stats_visited_members, stats_computed_distances, progress); break;
-    case scalar_kind_t::f16_k: search_typed<f16_t>(index, vectors_info, wanted, exact, threads, keys_py, distances_py, counts_py, stats_visited_members, stats_computed_distances, progress); break;
-    case scalar_kind_t::f32_k: search_typed<f32_t>(index, vectors_info, wanted, exact, threads, keys_py, distances_py, counts_py, stats_visited_members, stats_computed_distances, progress); break;
-    case scalar_kind_t::f64_k: search_typed<f64_t>(index, vectors_info, wanted, exact, threads, keys_py, distances_py, counts_py, stats_visited_members, stats_computed_distances, progress); break;
+    case scalar_kind_t::b1x8_k: search_typed<b1x8_t>(index, vectors_info, wanted, config, threads, keys_py, distances_py, counts_py, stats_visited_members, stats_computed_distances, progress); break;
+    case scalar_kind_t::i8_k: search_typed<i8_t>(index, vectors_info, wanted, config, threads, keys_py, distances_py, counts_py, stats_visited_members, stats_computed_distances, progress); break;
+    case scalar_kind_t::f16_k: search_typed<f16_t>(index, vectors_info, wanted, config, threads, keys_py, distances_py, counts_py, stats_visited_members, stats_computed_distances, progress); break;
+    case scalar_kind_t::f32_k: search_typed<f32_t>(index, vectors_info, wanted, config, threads, keys_py, distances_py, counts_py, stats_visited_members, stats_computed_distances, progress); break;
+    case scalar_kind_t::f64_k: search_typed<f64_t>(index, vectors_info, wanted, config, threads, keys_py, distances_py, counts_py, stats_visited_members, stats_computed_distances, progress); break;
     default: throw std::invalid_argument("Incompatible scalars in the query matrix: " + vectors_info.format);
     }
     // clang-format on
@@ -712,7 +718,8 @@ static void compact_index(dense_index_py_t& index, std::size_t threads, progress
     if (!index.reserve(index_limits_t(index.size(), threads)))
         throw std::invalid_argument("Out of memory!");
 
-    index.compact(executor_default_t{threads}, progress_t{progress});
+    dense_index_py_t::compaction_result_t result = index.isolate(executor_default_t{threads}, progress_t{progress});
+    forward_error(result);
 }
 
 static py::dict index_metadata(index_dense_metadata_result_t const& meta) {
@@ -973,7 +980,9 @@ PYBIND11_MODULE(compiled, m) {
         py::arg("count") = 10,                                  //
         py::arg("exact") = false,                               //
         py::arg("threads") = 0,                                 //
-        py::arg("progress") = nullptr                           //
+        py::arg("progress") = nullptr,                          //
+        py::arg("expansion") = 0,                               //
+        py::arg("radius") = std::numeric_limits<double>::max()  //
     );
 
     i.def(                                                     //
@@ -1036,17 +1045,13 @@ PYBIND11_MODULE(compiled, m) {
     i.def(
         "remove_one",
         [](dense_index_py_t& index, dense_key_t key, bool compact, std::size_t threads) -> bool {
-            dense_labeling_result_t result = index.remove(key);
-            forward_error(result);
-            if (!compact)
-                return result.completed;
-
             if (!threads)
                 threads = std::thread::hardware_concurrency();
-            if (!index.reserve(index_limits_t(index.size(), threads)))
-                throw std::invalid_argument("Out of memory!");
-
-            index.isolate(executor_default_t{threads});
+            dense_labeling_result_t result = index.remove(&key, &key + 1, executor_default_t{threads});
+            forward_error(result);
+            // Unlinks the removed entries right away, instead of waiting for enough of them to pile up
+            if (compact)
+                forward_error(index.isolate(executor_default_t{threads}));
             return result.completed;
         },
         py::arg("key"), py::arg("compact"), py::arg("threads"));
@@ -1055,17 +1060,13 @@ PYBIND11_MODULE(compiled, m) {
         "remove_many",
         [](dense_index_py_t& index, std::vector<dense_key_t> const& keys, bool compact,
            std::size_t threads) -> std::size_t {
-            dense_labeling_result_t result = index.remove(keys.begin(), keys.end());
-            forward_error(result);
-            if (!compact)
-                return result.completed;
-
             if (!threads)
                 threads = std::thread::hardware_concurrency();
-            if (!index.reserve(index_limits_t(index.size(), threads)))
-                throw std::invalid_argument("Out of memory!");
-
-            index.isolate(executor_default_t{threads});
+            dense_labeling_result_t result = index.remove(keys.begin(), keys.end(), executor_default_t{threads});
+            forward_error(result);
+            // Unlinks the removed entries right away, instead of waiting for enough of them to pile up
+            if (compact)
+                forward_error(index.isolate(executor_default_t{threads}));
             return result.completed;
         },
         py::arg("key"), py::arg("compact"), py::arg("threads"));
@@ -1226,6 +1227,8 @@ PYBIND11_MODULE(compiled, m) {
         py::arg("count") = 10,                                    //
         py::arg("exact") = false,                                 //
         py::arg("threads") = 0,                                   //
-        py::arg("progress") = nullptr                             //
+        py::arg("progress") = nullptr,                            //
+        py::arg("expansion") = 0,                                 //
+        py::arg("radius") = std::numeric_limits<double>::max()    //
     );
 }
@@ -207,6 +207,20 @@ def _search_in_compiled(
     return distill_batch(BatchMatches(*tuple_))
 
 
+def _search_overrides(
+    *, expansion: Optional[int] = None, radius: float = math.inf
+) -> Dict[str, Union[int, float]]:
+    """Per-call search options, only passed to the compiled index if set,
+    so that an infinite radius never reaches `-ffast-math` builds."""
+    overrides = {}
+    if expansion is not None:
+        assert isinstance(expansion, int) and expansion >= 0, "Expects integer `expansion`"
+        overrides["expansion"] = expansion
+    if math.isfinite(radius):
+        overrides["radius"] = radius
+    return overrides
+
+
 def _add_to_compiled(
     compiled,
     *,
@@ -673,6 +687,7 @@ class Index:
         *,
         threads: int = 0,
         exact: bool = False,
+        expansion: Optional[int] = None,
         log: Union[str, bool] = False,
         progress: Optional[ProgressCallback] = None,
     ) -> Union[Matches, BatchMatches]:
@@ -683,10 +698,14 @@ class Index:
         :type vectors: VectorOrVectorsLike
         :param count: Upper count on the number of matches to find
         :type count: int, defaults to 10
+        :param radius: Upper bound on the distance to matches, farther ones are dropped
+        :type radius: float, defaults to math.inf
         :param threads: Optimal number of cores to use
         :type threads: int, defaults to 0
         :param exact: Perform exhaustive linear-time exact search
         :type exact: bool, defaults to False
+        :param expansion: Traversal depth for this search only, overriding `.expansion_search`
+        :type expansion: Optional[int], defaults to None
         :param log: Whether to print the progress bar, default to False
         :type log: Union[str, bool], optional
         :param progress: Callback to report stats of the progress and control it
@@ -705,6 +724,7 @@ class Index:
             exact=exact,
             threads=threads,
             progress=progress,
+            **_search_overrides(expansion=expansion, radius=radius),
         )
 
     def contains(self, keys: KeyOrKeysLike) -> Union[bool, np.ndarray]:
@@ -793,13 +813,14 @@ class Index:
     ) -> Union[int, np.ndarray]:
         """Removes one or move vectors from the index.
 
-        When working with extremely large indexes, you may want to
-        mark some entries deleted, instead of rebuilding a filtered index.
-        In other cases, rebuilding - is the recommended approach.
+        Removed vectors are skipped by searches at once. Once they make up
+        a sixteenth of the index, or on `compact`, a pass over the whole graph
+        unlinks them, reconnecting their neighbors, and their slots are reused
+        by the following insertions.
 
         :param keys: Unique identifier for passed vectors, optional
         :type keys: KeyOrKeysLike
-        :param compact: Removes links to removed nodes (expensive), defaults to False
+        :param compact: Unlink the removed vectors right away, defaults to False
         :type compact: bool, optional
         :param threads: Optimal number of cores to use, defaults to 0
         :type threads: int, optional
@@ -1294,6 +1315,8 @@ class Indexes:
         *,
         threads: int = 0,
         exact: bool = False,
+        expansion: Optional[int] = None,
+        radius: float = math.inf,
         progress: Optional[ProgressCallback] = None,
     ):
         return _search_in_compiled(
@@ -1306,6 +1329,7 @@ class Indexes:
             exact=exact,
             threads=threads,
             progress=progress,
+            **_search_overrides(expansion=expansion, radius=radius),
         )
 
 